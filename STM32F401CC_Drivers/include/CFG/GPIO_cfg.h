@@ -0,0 +1,40 @@
+/******************************************************************************
+ *
+ * Module: GPIO Driver.
+ *
+ * File Name: GPIO_cfg.h
+ *
+ * Description: Configuration file for the GPIO Driver's parallel buses.
+ *
+ * Author: Shaher Shah Abdalla Kamal
+ *
+ * Date: 17-10-2026
+ *
+ *******************************************************************************/
+
+#ifndef GPIO_CFG_H_
+#define GPIO_CFG_H_
+
+
+/****************************************************************************************/
+/*							Configuration Macros Declaration							*/
+/****************************************************************************************/
+
+
+/* Description: The widest parallel bus (GPIO_strBus_t) in bits. Each port of a bus has one table of
+ * 				16 BSRR words for each 4 bits of this width, so a bus takes
+ * 				GPIO_BUS_MAX_PORTS * (GPIO_BUS_MAX_WIDTH / 4) * 64 bytes of RAM.
+ * Options:		4, 8, 12 or 16														*/
+#define GPIO_BUS_MAX_WIDTH						(8UL)
+/****************************************************************************************/
+
+/* Description: The most ports the pins of one parallel bus can be spread over, a write to the bus is
+ * 				one store to the BSRR of each of its ports. With 6 any pin map of up to
+ * 				GPIO_BUS_MAX_WIDTH pins is taken (the LCD's data pins are on any ports of
+ * 				"arrayofLCDPinConfig"), fewer save RAM but GPIO_enuInitBus refuses a bus on more ports.
+ * Options:		From 1 up to 6														*/
+#define GPIO_BUS_MAX_PORTS						(6UL)
+/****************************************************************************************/
+
+
+#endif /* GPIO_CFG_H_ */
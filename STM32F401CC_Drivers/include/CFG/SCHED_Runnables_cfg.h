@@ -33,5 +33,36 @@ typedef enum
 	_RunnablesNumber_
 }RunnablesList_t;
 
+/**
+ *@brief : Write down the names of the modes of your system, used with SCHED_MULTI_MODE_ENABLE.
+ * 			The scheduler starts in the first one.
+ */
+typedef enum
+{
+	normalMode,
+
+	/* DO NOT DELETE THIS ↓↓↓, please :)*/
+	_ModesNumber_
+}ModesList_t;
+
+
+
+/************************************************************************************/
+/*								Macros Declaration									*/
+/************************************************************************************/
+
+/**
+ *@brief : Write down the chains of your system, SCHED_CHAIN(Producer, Consumer) runs "Consumer" right
+ * 			after each run of "Producer", in the same tick (and at the priority of the producer).
+ * 			A consumer must come after its producer in "RunnablesList_t" and a producer has one
+ * 			consumer only, chain more runnables by making the consumer a producer too. A consumer
+ * 			that has nothing to do on its own leaves its "periodicityUS" zero.
+ * Example:
+ * #define SCHED_CHAINS_LIST \
+ * 			SCHED_CHAIN(switchRunnable, ctrlLED) \
+ * 			SCHED_CHAIN(ctrlLED, trafficLightSM)
+ */
+#define SCHED_CHAINS_LIST
+
 
 #endif /* SCHED_RUNNABLES_CFG_H_ */
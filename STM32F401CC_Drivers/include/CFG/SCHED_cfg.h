@@ -0,0 +1,213 @@
+/******************************************************************************
+ *
+ * Module: Scheduler Driver.
+ *
+ * File Name: SCHED_cfg.h
+ *
+ * Description: Configuration file for the Scheduler Driver.
+ *
+ * Author: Shaher Shah Abdalla Kamal
+ *
+ * Date: 15-03-2024
+ *
+ *******************************************************************************/
+
+#ifndef SCHED_CFG_H_
+#define SCHED_CFG_H_
+
+
+/****************************************************************************************/
+/*							Configuration Macros Declaration							*/
+/****************************************************************************************/
+
+
+/* Description: The scheduler's tick in microseconds, the time base interrupts once every tick. The
+ * 				periods and first delays of the runnables are in microseconds and are rounded down
+ * 				to whole ticks, so choose them as multiples of the tick.
+ * Options:		From 10 up, with the SysTick time base up to the max of SYSTICK_SetTimeMicroSec
+ * 				(1,000,000 us with 16 MHz AHB) if it's not a multiple of 1000		*/
+#define SCHED_TICK_US						1000
+/****************************************************************************************/
+
+/* Description: Choose the timer that counts the scheduler's ticks. With a general purpose 32-bit timer
+ * 				(TIM2 or TIM5, configured by CFG/TIM_cfg.h) the SysTick stays free for the application,
+ * 				and the timer's IRQ takes the place of the SysTick exception in all the modes below.
+ * 				With the SysTick the scheduler sets its period and subscribes to it (SYSTICK_Subscribe),
+ * 				the other subscribers (SWTIMER_TIME_BASE_SYSTICK) count the scheduler's ticks, so they
+ * 				can't share it in tickless mode where the period changes.
+ * Options:		SCHED_TIME_BASE_SYSTICK
+ * 		or		SCHED_TIME_BASE_TIM2
+ * 		or		SCHED_TIME_BASE_TIM5							*/
+#define SCHED_TIME_BASE						SCHED_TIME_BASE_SYSTICK
+/****************************************************************************************/
+
+/* Description: Number of slots in the timing wheel that holds the next release of each runnable.
+ * 				Every tick the scheduler only visits the slot of the current tick, a runnable whose
+ * 				next release is further than one wheel revolution away is just skipped once per
+ * 				revolution until its turn comes.
+ * 				RAM used by the wheel = SCHED_WHEEL_SLOTS * 4 bytes for every 32 runnables.
+ * Options:		Any power of two from 2 up to 256 (bigger wheel = fewer skips, more RAM)	*/
+#define SCHED_WHEEL_SLOTS					64
+/****************************************************************************************/
+
+/* Description: Choose whether the scheduler runs tickless or not. In tickless mode the SysTick only
+ * 				interrupts when the next runnable is released and the core sleeps (WFI) in between,
+ * 				otherwise the SysTick interrupts every tick and the core polls for it.
+ * Options:		SCHED_TICKLESS_ENABLE
+ * 		or		SCHED_TICKLESS_DISABLE						*/
+#define SCHED_TICKLESS_MODE					SCHED_TICKLESS_DISABLE
+/****************************************************************************************/
+
+/* Description: The longest period the time base may be programmed to in tickless mode, the scheduler
+ * 				wakes up at least once every this period even if no runnable is released.
+ * Options:		From two ticks up to what the time base can count, checked at compile time:
+ * 				SysTick: 0xFFFFFF counts of AHB/8 (8388 ms with 16 MHz AHB), or of AHB (1048 ms) if
+ * 				SCHED_TICK_US is not a multiple of 1000.
+ * 				TIM2/TIM5: up to 4,000,000 ms											*/
+#define SCHED_TICKLESS_MAX_SLEEP_MS			8000
+/****************************************************************************************/
+
+/* Description: Choose whether the scheduler measures the execution time of each runnable with the
+ * 				DWT cycle counter or not, the measurements are read with SCHED_getStats.
+ * Options:		SCHED_PROFILING_ENABLE
+ * 		or		SCHED_PROFILING_DISABLE						*/
+#define SCHED_PROFILING_MODE				SCHED_PROFILING_DISABLE
+/****************************************************************************************/
+
+/* Description: Choose what the scheduler does with the releases of the ticks that passed while it was
+ * 				busy (a runnable took longer than a tick):
+ * 				SCHED_CATCHUP_RUN_ALL:	 run every missed release late, one after the other.
+ * 				SCHED_CATCHUP_COALESCE:	 run a runnable once for all its missed releases.
+ * 				SCHED_CATCHUP_SKIP:		 drop the missed releases, the runnable runs at its next
+ * 										 release that is not passed yet.
+ * 				In all cases a runnable keeps the phase of its first release.
+ * Options:		SCHED_CATCHUP_RUN_ALL
+ * 		or		SCHED_CATCHUP_COALESCE
+ * 		or		SCHED_CATCHUP_SKIP							*/
+#define SCHED_CATCHUP_POLICY				SCHED_CATCHUP_RUN_ALL
+/****************************************************************************************/
+
+/* Description: Choose the order in which the released runnables run:
+ * 				SCHED_DISPATCH_FIXED_PRIORITY: at the tick of their release, in the order of "arrayOfRunnables".
+ * 				SCHED_DISPATCH_EDF:			   earliest deadline first, the releases wait in a heap ordered
+ * 											   by their deadlines (the next release of each runnable) and
+ * 											   the main loop runs the earliest one, taking the new
+ * 											   releases in between the runs. A set up to 100% utilisation
+ * 											   can be served if no runnable blocks the shorter periods for
+ * 											   too long, check it with tools/SCHED_planner/SCHED_planner.py --check.
+ * 				A release of a runnable that is still waiting is merged into the waiting one. The
+ * 				runnables still run to completion, EDF can't be used with preemptive or cyclic executive modes.
+ * Options:		SCHED_DISPATCH_FIXED_PRIORITY
+ * 		or		SCHED_DISPATCH_EDF								*/
+#define SCHED_DISPATCH_POLICY				SCHED_DISPATCH_FIXED_PRIORITY
+/****************************************************************************************/
+
+/* Description: Choose whether the scheduler records its timing health or not: the backlog of ticks,
+ * 				the deadline misses of each runnable, and histograms of the delay between the release
+ * 				of each runnable and its start (measured by the DWT cycle counter). It's read with
+ * 				SCHED_getHealth.
+ * Options:		SCHED_TIMING_HEALTH_ENABLE
+ * 		or		SCHED_TIMING_HEALTH_DISABLE					*/
+#define SCHED_TIMING_HEALTH_MODE			SCHED_TIMING_HEALTH_DISABLE
+/****************************************************************************************/
+
+/* Description: Number of buckets in the jitter histogram of each runnable, and the width of each bucket.
+ * Options:		Buckets from 2 up to 32, width in microseconds from 1 and more	*/
+#define SCHED_JITTER_BUCKETS				16
+#define SCHED_JITTER_BUCKET_US				50
+/****************************************************************************************/
+
+/* Description: Choose whether the scheduler records a trace or not: the start and the end of every run
+ * 				of a runnable and of the scheduler's tick interrupt (and of the interrupts that call
+ * 				SCHED_traceIsrEnter and SCHED_traceIsrExit), each with the DWT cycle counter, in a ring
+ * 				in RAM that keeps the latest records. The ring is the variable "schedTrace", read it
+ * 				with a debugger or send the bytes given by SCHED_getTrace over a UART, then convert them
+ * 				with tools/SCHED_trace/SCHED_trace.py to view the timeline in Perfetto or chrome://tracing.
+ * Options:		SCHED_TRACE_ENABLE
+ * 		or		SCHED_TRACE_DISABLE								*/
+#define SCHED_TRACE_MODE					SCHED_TRACE_DISABLE
+/****************************************************************************************/
+
+/* Description: Number of records in the trace ring, each one takes 8 bytes.
+ * Options:		Any power of two from 16 up to 32768							*/
+#define SCHED_TRACE_RECORDS					512
+/****************************************************************************************/
+
+/* Description: Choose whether the runnables preempt each other by their priorities or not. In preemptive
+ * 				mode the SysTick handler releases the runnables, the ones with priority zero run in the
+ * 				main loop and each higher priority runs in an exception handler (PendSV for priority 1,
+ * 				the IRQs below for the others) so it preempts the lower ones. All of them share the
+ * 				main stack and run to completion.
+ * 				A release of a runnable whose previous release hasn't run yet is a deadline miss, it's
+ * 				run again later with SCHED_CATCHUP_RUN_ALL and merged into the waiting one otherwise.
+ * 				It can't be used in tickless mode.
+ * Options:		SCHED_PREEMPTIVE_ENABLE
+ * 		or		SCHED_PREEMPTIVE_DISABLE					*/
+#define SCHED_PREEMPTIVE_MODE				SCHED_PREEMPTIVE_DISABLE
+/****************************************************************************************/
+
+/* Description: Number of priorities above zero in preemptive mode.
+ * Options:		From 1 up to 4													*/
+#define SCHED_PREEMPTIVE_LEVELS				2
+/****************************************************************************************/
+
+/* Description: NVIC preemption level of the PendSV that runs priority 1, priority (k) runs at
+ * 				(SCHED_LOWEST_PREEMPTION_LEVEL - k + 1) and the SysTick one level above the highest
+ * 				priority. Interrupts above the SysTick must not call the scheduler's APIs.
+ * 				SCHED_init sets the priority group to PG_GPB_7_TO_4_SPB_NONE_MASK, the other interrupts
+ * 				must use this group too.
+ * Options:		From PREEMPTION_LEVEL_(SCHED_PREEMPTIVE_LEVELS) up to PREEMPTION_LEVEL_15	*/
+#define SCHED_LOWEST_PREEMPTION_LEVEL		PREEMPTION_LEVEL_15
+/****************************************************************************************/
+
+/* Description: IRQs of unused peripherals that run the priorities from 2 up to 4, and their handlers'
+ * 				names as in the vector table.
+ * Options:		Any IRQ from IRQs_t that is not used by the application			*/
+#define SCHED_PRIORITY_2_IRQ				IRQ_SPI4
+#define SCHED_PRIORITY_2_IRQ_HANDLER		SPI4_IRQHandler
+#define SCHED_PRIORITY_3_IRQ				IRQ_SDIO
+#define SCHED_PRIORITY_3_IRQ_HANDLER		SDIO_IRQHandler
+#define SCHED_PRIORITY_4_IRQ				IRQ_I2C3_ER
+#define SCHED_PRIORITY_4_IRQ_HANDLER		I2C3_ER_IRQHandler
+/****************************************************************************************/
+
+/* Description: Choose whether the periodic runnables are dispatched from a frame table that is generated
+ * 				before the build (src/CFG/SCHED_CyclicTable_cfg.c by tools/SCHED_planner/SCHED_cyclic_gen.py)
+ * 				or not. In cyclic executive mode the SysTick handler runs the list of call backs of the
+ * 				current frame and moves to the next one, nothing is calculated at run time. The main
+ * 				loop only runs the event runnables.
+ * 				It can't be used with tickless, preemptive or timing health modes, the profiling measures
+ * 				the frames only.
+ * Options:		SCHED_CYCLIC_EXECUTIVE_ENABLE
+ * 		or		SCHED_CYCLIC_EXECUTIVE_DISABLE				*/
+#define SCHED_CYCLIC_EXECUTIVE_MODE			SCHED_CYCLIC_EXECUTIVE_DISABLE
+/****************************************************************************************/
+
+/* Description: Choose whether the runnables are grouped in modes (startup, normal, degraded, low power...)
+ * 				or not. Each mode of "arrayOfModes" lists the runnables that run in it, the others are
+ * 				not released and their events are dropped. SCHED_requestMode asks for another mode, the
+ * 				scheduler switches at the next end of the hyperperiod of the current mode (when all of
+ * 				its periodic runnables are back at their first phase), and the new mode starts from
+ * 				there with the "firstDelayUS" of its runnables.
+ * 				It can't be used with cyclic executive mode.
+ * Options:		SCHED_MULTI_MODE_ENABLE
+ * 		or		SCHED_MULTI_MODE_DISABLE						*/
+#define SCHED_MULTI_MODE					SCHED_MULTI_MODE_DISABLE
+/****************************************************************************************/
+
+/* Description: Number of slots for the runnables added at run time by SCHED_addRunnable, they come
+ * 				after the runnables of "arrayOfRunnables" (lower priority) in the order of their slots
+ * 				and are not part of any mode. A free slot costs nothing at run time, 0 removes them.
+ * 				It can't be used with cyclic executive mode.
+ * Options:		From 0 up to 64									*/
+#define SCHED_DYNAMIC_SLOTS					0
+/****************************************************************************************/
+
+/* Description: Number of events posted by SCHED_postEvent that can wait for the scheduler, a post to
+ * 				a full queue is dropped. In preemptive mode the queue is read at the highest priority.
+ * Options:		Any power of two from 2 up to 256								*/
+#define SCHED_EVENT_QUEUE_SIZE				16
+/****************************************************************************************/
+
+
+#endif /* SCHED_CFG_H_ */
@@ -0,0 +1,75 @@
+/******************************************************************************
+ *
+ * Module: Software Timers Service.
+ *
+ * File Name: SWTIMER_cfg.h
+ *
+ * Description: Configuration file for the Software Timers Service.
+ *
+ * Author: Shaher Shah Abdalla Kamal
+ *
+ * Date: 17-10-2026
+ *
+ *******************************************************************************/
+
+#ifndef SWTIMER_CFG_H_
+#define SWTIMER_CFG_H_
+
+
+/****************************************************************************************/
+/*							Configuration Macros Declaration							*/
+/****************************************************************************************/
+
+
+/* Description: The software timers' tick in microseconds, the delays and the periods of the timers are
+ * 				rounded up to whole ticks.
+ * Options:		From 10 up, with the SysTick time base up to the max of SYSTICK_SetTimeMicroSec
+ * 				(1,000,000 us with 16 MHz AHB) if it's not a multiple of 1000, and a multiple of
+ * 				SCHED_TICK_US if the scheduler uses the SysTick too						*/
+#define SWTIMER_TICK_US						1000
+/****************************************************************************************/
+
+/* Description: Choose the timer that counts the software timers' ticks. A timer must not be the time base
+ * 				of the scheduler (SCHED_TIME_BASE), the SysTick is shared with it: the software timers
+ * 				subscribe to the scheduler's SysTick and count its ticks (not in tickless mode), the
+ * 				SysTick is set and started by SCHED_init and SCHED_start. With SWTIMER_TIME_BASE_EXTERNAL
+ * 				nothing is configured and the application calls SWTIMER_tick once every SWTIMER_TICK_US
+ * 				from an interrupt of its own.
+ * Options:		SWTIMER_TIME_BASE_SYSTICK
+ * 		or		SWTIMER_TIME_BASE_TIM2
+ * 		or		SWTIMER_TIME_BASE_TIM5
+ * 		or		SWTIMER_TIME_BASE_EXTERNAL						*/
+#define SWTIMER_TIME_BASE					SWTIMER_TIME_BASE_TIM5
+/****************************************************************************************/
+
+/* Description: Number of levels of the timing wheel, each level has 64 slots and covers 64 times the
+ * 				range of the level below it. The longest delay or period is 64 ^ SWTIMER_WHEEL_LEVELS ticks
+ * 				(4 levels = 16,777,216 ticks, 4.6 hours with a 1 ms tick).
+ * 				RAM used by the wheel = SWTIMER_WHEEL_LEVELS * 512 bytes.
+ * Options:		From 1 up to 5													*/
+#define SWTIMER_WHEEL_LEVELS				4
+/****************************************************************************************/
+
+/* Description: Number of expiries of the SWTIMER_DISPATCH_DEFERRED timers that can wait for
+ * 				SWTIMER_dispatchDeferred, an expiry of a timer that is already waiting is merged into
+ * 				the waiting one and an expiry that finds the queue full is dropped (both are counted by
+ * 				SWTIMER_getMissedExpiries).
+ * Options:		Any power of two from 2 up to 256								*/
+#define SWTIMER_DEFERRED_QUEUE_SIZE			16
+/****************************************************************************************/
+
+/* Description: Choose who calls SWTIMER_dispatchDeferred:
+ * 				SWTIMER_DEFERRED_POLLING:  the application, from its main loop.
+ * 				SWTIMER_DEFERRED_SCHED:	   the scheduler, SWTIMER_DEFERRED_RUNNABLE is an event runnable
+ * 										   (SCHED_ACTIVATION_EVENT) of "arrayOfRunnables" whose callBackFn
+ * 										   is SWTIMER_dispatchDeferred, the tick posts its event when a
+ * 										   deferred timer expires. The other callers of SCHED_postEvent
+ * 										   must have the preemption level of the tick's interrupt.
+ * Options:		SWTIMER_DEFERRED_POLLING
+ * 		or		SWTIMER_DEFERRED_SCHED							*/
+#define SWTIMER_DEFERRED_MODE				SWTIMER_DEFERRED_POLLING
+#define SWTIMER_DEFERRED_RUNNABLE			swTimersRunnable
+/****************************************************************************************/
+
+
+#endif /* SWTIMER_CFG_H_ */
@@ -26,5 +26,12 @@
 #define AHB_CLOCK_SOURCE_VALUE					(16000000UL)
 
 
+/* Description: Number of call backs that can subscribe to the SysTick interrupt (SYSTICK_Subscribe and
+ * 				SYSTICK_SetCallBack), each one takes 12 bytes of RAM and only the subscribed ones are
+ * 				visited by the handler.
+ * Options:	From 1 up to 16 */
+#define SYSTICK_SUBSCRIBERS_NUMBER				(4)
+
+
 
 #endif /* SYSTICK_CFG_H_ */
@@ -0,0 +1,30 @@
+/******************************************************************************
+ *
+ * Module: TIM Driver.
+ *
+ * File Name: TIM_cfg.h
+ *
+ * Description: Configuration file for the general purpose 32-bit timers (TIM2 and TIM5) Driver.
+ *
+ * Author: Shaher Shah Abdalla Kamal
+ *
+ * Date: 17-10-2026
+ *
+ *******************************************************************************/
+
+#ifndef TIM_CFG_H_
+#define TIM_CFG_H_
+
+
+/****************************************************************************************/
+/*							Configuration Macros Declaration							*/
+/****************************************************************************************/
+
+
+/* Description: Enter the value of the clock of the APB1 timers (TIMxCLK), it's the APB1 clock if the
+ * 				APB1 pre-scaler is 1 and twice the APB1 clock otherwise (with TIMPRE cleared).
+ * Options:	Enter the value of the timers' clock in Hz, a multiple of 1 MHz */
+#define TIM_CLOCK_SOURCE_VALUE					(16000000UL)
+
+
+#endif /* TIM_CFG_H_ */
@@ -419,7 +419,8 @@ LCD_enuError_t LCD_enuInitAsync(void (*callBackFn)(void));
 
 
 /**
- *@brief : Function that returns to you the current state of the LCD.
+ *@brief : Function that returns to you the current state of the LCD: 0 off, 1 initializing, 2 operational
+ * 			or 3 error (the GPIO driver refused the pins of "arrayofLCDPinConfig", the LCD takes no requests).
  *@param : pointer inside which We will return to you the state of the LCD.
  *@return: Error State.
  */
@@ -150,5 +150,12 @@ LED_enuErrorStatus_t LED_enuPowerON(uint8_t copy_LEDname);
  */
 LED_enuErrorStatus_t LED_enuPowerOFF(uint8_t copy_LEDname);
 
+/**
+ *@brief : Function to toggle the entered LED.
+ *@param : Name of the LED you want to toggle.
+ *@return: Error Status.
+ */
+LED_enuErrorStatus_t LED_enuToggle(uint8_t copy_LEDname);
+
 
 #endif /* LED_H_ */
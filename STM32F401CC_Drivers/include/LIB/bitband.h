@@ -0,0 +1,65 @@
+/******************************************************************************
+ *
+ * Module: Common - Bit-Band Access
+ *
+ * File Name: bitband.h
+ *
+ * Description: Cortex-M4 bit-band aliases of the peripherals. Each bit of the first MB of the
+ * 				peripherals (0x40000000, APB1, APB2 and AHB1 of the STM32F401) has its own word in an
+ * 				alias region, a load of the word gives the bit (0 or 1) and a store of 0 or 1 changes
+ * 				only that bit. The store is one locked read-modify-write done by the bus, so it can't
+ * 				be broken by an interrupt and it's safe from ISRs with no critical section.
+ *
+ * 				e.g.
+ * 				#define LED_PIN_ODR		GPIO_BITBAND_ODR(GPIO_PORTA, GPIO_PIN5)
+ * 				LED_PIN_ODR = 1;
+ * 				if (GPIO_BITBAND_IDR(GPIO_PORTC, GPIO_PIN13) == 0) { ... }
+ *
+ * Author: Shaher Shah Abdalla Kamal
+ *
+ * Date: 17-10-2026
+ *
+ *******************************************************************************/
+
+#ifndef BITBAND_H_
+#define BITBAND_H_
+
+
+#include <LIB/std_types.h>
+
+
+/* The bit-band region of the peripherals and its alias */
+#define BITBAND_PERIPH_BASE				(0x40000000UL)
+#define BITBAND_PERIPH_ALIAS_BASE		(0x42000000UL)
+#define BITBAND_REGION_SIZE				(0x00100000UL)
+
+
+/**
+ *@brief : Gives 0 if "Condition" is true and stops the compilation if it's false or if it isn't a
+ * 			constant expression.
+ */
+#define BITBAND_CHECK(Condition)\
+	(0UL * sizeof(struct { _Static_assert((Condition), "bit-band address or bit is out of range"); int x; }))
+
+/**
+ *@brief : The address of the alias word of a peripheral's bit, with no check (for addresses known only
+ * 			at run time, that the caller has already validated).
+ *@param : Address of the word that has the bit, bit number (0..31).
+ */
+#define BITBAND_PERIPH_ALIAS_ADDRESS(Address, Bit)\
+	(BITBAND_PERIPH_ALIAS_BASE + ((((uint32_t)(Address)) - BITBAND_PERIPH_BASE) << 5) + (((uint32_t)(Bit)) << 2))
+
+/**
+ *@brief : The alias word of a peripheral's bit, as a volatile uint32_t that can be read and written.
+ * 			The address and the bit must be constant expressions, an address out of the region, one
+ * 			that isn't word aligned or a bit above 31 stops the compilation.
+ *@param : Address of the word that has the bit, bit number (0..31).
+ */
+#define BITBAND_PERIPH(Address, Bit)\
+	(*(volatile uint32_t*)(BITBAND_PERIPH_ALIAS_ADDRESS(Address, Bit)\
+		+ BITBAND_CHECK(((uint32_t)(Address) >= BITBAND_PERIPH_BASE)\
+						&& ((uint32_t)(Address) < (BITBAND_PERIPH_BASE + BITBAND_REGION_SIZE))\
+						&& (((uint32_t)(Address) & 3UL) == 0) && ((uint32_t)(Bit) < 32UL))))
+
+
+#endif /* BITBAND_H_ */
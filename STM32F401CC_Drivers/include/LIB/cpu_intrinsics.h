@@ -0,0 +1,120 @@
+/******************************************************************************
+ *
+ * Module: Common - CPU Instructions Abstraction
+ *
+ * File Name: cpu_intrinsics.h
+ *
+ * Description: Cortex-M4 instructions that can not be written in C.
+ *
+ * Author: Shaher Shah Abdalla Kamal
+ *
+ * Date: 17-10-2026
+ *
+ *******************************************************************************/
+
+#ifndef CPU_INTRINSICS_H_
+#define CPU_INTRINSICS_H_
+
+
+#include <LIB/std_types.h>
+
+
+/**
+ *@brief : Mask all the configurable interrupts (set PRIMASK).
+ *@param : void.
+ *@return: void.
+ */
+static inline void CPU_DisableInterrupts(void)
+{
+	__asm volatile ("cpsid i" : : : "memory");
+}
+
+
+/**
+ *@brief : Unmask the configurable interrupts (clear PRIMASK).
+ *@param : void.
+ *@return: void.
+ */
+static inline void CPU_EnableInterrupts(void)
+{
+	__asm volatile ("cpsie i" : : : "memory");
+}
+
+
+/**
+ *@brief : Mask all the configurable interrupts and give the previous state of PRIMASK, so a critical
+ * 			section can be entered even if they are already masked.
+ *@param : void.
+ *@return: PRIMASK value before masking, to be passed to CPU_RestoreInterrupts.
+ */
+static inline uint32_t CPU_SaveAndDisableInterrupts(void)
+{
+	uint32_t LOC_u32Value;
+
+	__asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (LOC_u32Value) : : "memory");
+
+	return LOC_u32Value;
+}
+
+
+/**
+ *@brief : Write back the PRIMASK value saved by CPU_SaveAndDisableInterrupts.
+ *@param : PRIMASK value.
+ *@return: void.
+ */
+static inline void CPU_RestoreInterrupts(uint32_t Copy_u32Value)
+{
+	__asm volatile ("msr primask, %0" : : "r" (Copy_u32Value) : "memory");
+}
+
+
+/**
+ *@brief : Put the core to sleep until an interrupt becomes pending, it wakes up even if
+ * 			the interrupts are masked by PRIMASK.
+ *@param : void.
+ *@return: void.
+ */
+static inline void CPU_WaitForInterrupt(void)
+{
+	__asm volatile ("dsb\n\twfi" : : : "memory");
+}
+
+
+/**
+ *@brief : Read the BASEPRI register, the priority under which the exceptions are masked (0 = none is masked).
+ *@param : void.
+ *@return: BASEPRI value.
+ */
+static inline uint32_t CPU_GetBasePriority(void)
+{
+	uint32_t LOC_u32Value;
+
+	__asm volatile ("mrs %0, basepri" : "=r" (LOC_u32Value));
+
+	return LOC_u32Value;
+}
+
+
+/**
+ *@brief : Write the BASEPRI register.
+ *@param : BASEPRI value.
+ *@return: void.
+ */
+static inline void CPU_SetBasePriority(uint32_t Copy_u32Value)
+{
+	__asm volatile ("msr basepri, %0" : : "r" (Copy_u32Value) : "memory");
+}
+
+
+/**
+ *@brief : Write the BASEPRI register only if the new value masks more exceptions than the current one.
+ *@param : BASEPRI value.
+ *@return: void.
+ */
+static inline void CPU_RaiseBasePriority(uint32_t Copy_u32Value)
+{
+	__asm volatile ("msr basepri_max, %0" : : "r" (Copy_u32Value) : "memory");
+}
+
+
+#endif /* CPU_INTRINSICS_H_ */
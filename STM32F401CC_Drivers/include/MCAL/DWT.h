@@ -0,0 +1,141 @@
+/******************************************************************************
+*
+* Module: DWT Driver.
+*
+* File Name: DWT.h
+*
+* Description: Driver's APIs' prototypes and typedefs' declaration.
+*
+* Author: Shaher Shah Abdalla Kamal
+*
+* Date:	17-10-2026
+*
+*******************************************************************************/
+
+#ifndef DWT_INTERFACE_H_
+#define DWT_INTERFACE_H_
+
+
+
+/****************************************************************************************/
+/*										Includes										*/
+/****************************************************************************************/
+
+#include <LIB/std_types.h>
+
+
+
+/****************************************************************************************/
+/*								User-defined types Declaration							*/
+/****************************************************************************************/
+
+
+/**
+ *@brief : The Error List Type
+ */
+typedef enum
+{
+	/**
+	 *@brief : Everything OK, function had Performed Correctly.
+	 */
+	DWT_enuOk = 0,
+	/**
+	 *@brief : Something went wrong in the function.
+	 */
+	DWT_enuNotOk,
+	/**
+	 *@brief : The cycle counter is not implemented in this core.
+	 */
+	DWT_enuCycleCounterNotSupported
+
+}DWT_enuErrorStatus_t;
+
+/* A deadline counted by the cycle counter, it's started by DWT_vStartDeadline and checked by
+ * DWT_u8IsDeadlinePassed. Its members are owned by the driver, don't change them */
+typedef struct
+{
+	uint32_t lastCycles;
+	uint64_t remainingCycles;
+}DWT_strDeadline_t;
+
+
+
+/****************************************************************************************/
+/*									Functions' Declaration								*/
+/****************************************************************************************/
+
+
+/**
+ *@brief : Function to enable the DWT unit and start its cycle counter (CYCCNT) from zero.
+ *@param : void.
+ *@return: Error status.
+ */
+DWT_enuErrorStatus_t DWT_enuInit(void);
+
+
+/**
+ *@brief : Function to get the number of core clock cycles counted by the cycle counter, it wraps
+ * 			around every 2^32 cycles (about 51 seconds at 84 MHz).
+ *@param : void.
+ *@return: The cycle counter value.
+ */
+uint32_t DWT_u32GetCycleCount(void);
+
+
+/**
+ *@brief : Function to tell the driver the core clock (HCLK), the delays and the deadlines are converted
+ * 			to cycles with it. It's 16 MHz (HSI) after reset and it's updated by the RCC driver when it
+ * 			switches the system clock or the AHB pre-scaler.
+ *@param : The core clock in Hz.
+ *@return: Error status.
+ */
+DWT_enuErrorStatus_t DWT_enuSetCoreClock(uint32_t Copy_u32CoreClock);
+
+
+/**
+ *@brief : Function to get the core clock the delays and the deadlines are converted with.
+ *@param : void.
+ *@return: The core clock in Hz.
+ */
+uint32_t DWT_u32GetCoreClock(void);
+
+
+/**
+ *@brief : Function to busy-wait for at least the given microseconds, the cycle counter is started if it
+ * 			isn't counting. Interrupts that come during the wait lengthen it only if they take longer
+ * 			than the rest of it.
+ *@param : The delay in microseconds.
+ *@return: void.
+ */
+void DWT_vDelayMicroSec(uint32_t Copy_u32DelayUS);
+
+
+/**
+ *@brief : Function to busy-wait for at least the given nanoseconds, rounded up to a whole core cycle.
+ * 			The call itself takes a few tens of cycles, so short delays are longer than asked for.
+ *@param : The delay in nanoseconds.
+ *@return: void.
+ */
+void DWT_vDelayNanoSec(uint32_t Copy_u32DelayNS);
+
+
+/**
+ *@brief : Function to start a deadline that passes after the given microseconds, the cycle counter is
+ * 			started if it isn't counting. A deadline of any length works as long as it's checked at
+ * 			least once every 2^32 cycles.
+ *@param : The deadline and its timeout in microseconds.
+ *@return: void.
+ */
+void DWT_vStartDeadline(DWT_strDeadline_t* Add_pstrDeadline, uint32_t Copy_u32TimeoutUS);
+
+
+/**
+ *@brief : Function to check if a deadline has passed.
+ *@param : The deadline.
+ *@return: 1 if it has passed, 0 otherwise.
+ */
+uint8_t DWT_u8IsDeadlinePassed(DWT_strDeadline_t* Add_pstrDeadline);
+
+
+
+#endif /* DWT_INTERFACE_H_ */
@@ -23,6 +23,8 @@
 /****************************************************************************************/
 /* ِIncluding the .h file that contains typedefs for the primitive data types */
 #include <LIB/std_types.h>
+#include <LIB/bitband.h>
+#include <CFG/GPIO_cfg.h>
 
 
 
@@ -126,6 +128,40 @@
 /****************************************************************************************/
 
 
+/* Offsets in words of the IDR and the ODR from the BSRR (IDR at 0x10, ODR at 0x14, BSRR at 0x18),
+ * the pin handles keep the address of the BSRR only */
+
+#define GPIO_IDR_FROM_BSRR				(-2)
+#define GPIO_ODR_FROM_BSRR				(-1)
+
+/* The reset bits of the BSRR are above its 16 set bits */
+#define GPIO_BSRR_RESET_SHIFT			(16UL)
+/****************************************************************************************/
+
+
+/* Bit-band access to one pin, the port and the pin must be constant expressions and they are checked
+ * at compile time. GPIO_BITBAND_IDR reads the pin (0 or 1), GPIO_BITBAND_ODR reads or writes its output
+ * with one instruction that an interrupt can't break, e.g. GPIO_BITBAND_ODR(GPIO_PORTA, GPIO_PIN5) = 1; */
+
+#define GPIO_IDR_OFFSET					(0x10UL)
+#define GPIO_ODR_OFFSET					(0x14UL)
+
+#define GPIO_BITBAND_CHECK(Port, Pin)	BITBAND_CHECK(((Port) >= GPIO_PORTA) && ((Port) <= GPIO_PORTH)\
+													&& ((Pin) <= GPIO_PIN15))
+#define GPIO_BITBAND_IDR(Port, Pin)		BITBAND_PERIPH((Port) + GPIO_IDR_OFFSET + GPIO_BITBAND_CHECK(Port, Pin), Pin)
+#define GPIO_BITBAND_ODR(Port, Pin)		BITBAND_PERIPH((Port) + GPIO_ODR_OFFSET + GPIO_BITBAND_CHECK(Port, Pin), Pin)
+/****************************************************************************************/
+
+
+/* The parallel buses split a value into nibbles, each nibble picks one of 16 BSRR words of a port */
+
+#define GPIO_BUS_NIBBLE_BITS			(4UL)
+#define GPIO_BUS_NIBBLE_MASK			(0xFUL)
+#define GPIO_BUS_NIBBLE_VALUES			(16UL)
+#define GPIO_BUS_MAX_NIBBLES			(GPIO_BUS_MAX_WIDTH / GPIO_BUS_NIBBLE_BITS)
+/****************************************************************************************/
+
+
 
 /****************************************************************************************/
 /*								User-defined types Declaration							*/
@@ -161,6 +197,35 @@ typedef struct {
 }GPIO_strPinConfig_t;
 
 
+/* A pin validated once by GPIO_enuInitPinHandle, the inline accessors below drive it with no checks */
+typedef struct {
+	/* Address of the BSRR of the pin's port */
+	volatile uint32_t* BSRR;
+	/* The pin's bit in the set half of the BSRR (also its bit in the IDR and the ODR) */
+	uint32_t setMask;
+	/* The pin's bit in the reset half of the BSRR */
+	uint32_t resetMask;
+}GPIO_strPinHandle_t;
+
+
+/* A line of a parallel bus */
+typedef struct {
+	uint32_t GPIO_port;
+	uint32_t GPIO_pin;
+}GPIO_strBusPin_t;
+
+/* A parallel bus of pins on any ports, filled by GPIO_enuInitBus and written by GPIO_vWriteBus */
+typedef struct {
+	/* Address of the BSRR of each port of the bus */
+	volatile uint32_t* BSRR[GPIO_BUS_MAX_PORTS];
+	/* For each port and each nibble of the bus, the BSRR word that puts each value of the nibble on the
+	 * port's lines of that nibble, it sets the lines of the 1 bits and resets the lines of the 0 bits */
+	uint32_t BSRRTable[GPIO_BUS_MAX_PORTS][GPIO_BUS_MAX_NIBBLES][GPIO_BUS_NIBBLE_VALUES];
+	uint8_t portsNumber;
+	uint8_t nibblesNumber;
+}GPIO_strBus_t;
+
+
 
 /****************************************************************************************/
 /*									Functions' Declaration								*/
@@ -175,6 +240,15 @@ typedef struct {
 GPIO_enuErrorStatus_t GPIO_enuInitPin(GPIO_strPinConfig_t* Add_strPinConfig);
 
 
+/**
+ *@brief : Function to Configure many GPIO pins together, each register of each port is written once
+ * 			(MODER last) and nothing is written if one of the configurations is wrong.
+ *@param : Address of an array of pins' configurations, Number of the configurations.
+ *@return: Error status.
+ */
+GPIO_enuErrorStatus_t GPIO_enuInitPins(const GPIO_strPinConfig_t* Add_pstrPinsConfig, uint32_t Copy_u32PinsNumber);
+
+
 /**
  *@brief : Function to Configure the GPIO' pins to an alternate function.
  *@param : 	Address of the structure that contains port number, pin number, speed and direction mode.
@@ -200,6 +274,139 @@ GPIO_enuErrorStatus_t GPIO_enuSetPinVal(uint32_t Copy_u32PortNum, uint32_t Copy_
 GPIO_enuErrorStatus_t GPIO_enuGetPinVal(uint32_t Copy_u32PortNum, uint32_t Copy_u32PinNum,\
 										uint32_t* Add_Pu32PinVal);
 
+/**
+ *@brief  : Function to Set any group of a port's pins to their values at the same instant, with one
+ * 			write to the BSRR.
+ *@param  : Port Number, Mask of the pins to change (bit n is pin n), their values (bit n is the value of
+ * 			pin n, the bits out of the mask are ignored).
+ *@return : Error status.
+ */
+GPIO_enuErrorStatus_t GPIO_enuSetPortMasked(uint32_t Copy_u32PortNum, uint32_t Copy_u32Mask,\
+											uint32_t Copy_u32Value);
+
+/**
+ *@brief  : Function to Read the Logic State of all the pins of a port at the same instant, with one
+ * 			read of the IDR.
+ *@param  : Port Number, Pointer to return the pins' states (bit n is the state of pin n).
+ *@return : Error status.
+ */
+GPIO_enuErrorStatus_t GPIO_enuGetPort(uint32_t Copy_u32PortNum, uint32_t* Add_Pu32PortVal);
+
+/**
+ *@brief  : Function to validate a pin once and fill its handle for the inline accessors.
+ *@param  : Address of the handle, Port Number, Pin Number.
+ *@return : Error status.
+ */
+GPIO_enuErrorStatus_t GPIO_enuInitPinHandle(GPIO_strPinHandle_t* Add_pstrPinHandle, uint32_t Copy_u32PortNum,\
+											uint32_t Copy_u32PinNum);
+
+
+/**
+ *@brief  : Function to validate the lines of a parallel bus once and build its BSRR tables, the pins
+ * 			must be configured as outputs separately.
+ *@param  : Address of the bus, Address of an array of its lines (the line i carries the bit i of the
+ * 			values), Number of its lines (1 ~ GPIO_BUS_MAX_WIDTH, on up to GPIO_BUS_MAX_PORTS ports).
+ *@return : Error status.
+ */
+GPIO_enuErrorStatus_t GPIO_enuInitBus(GPIO_strBus_t* Add_pstrBus, const GPIO_strBusPin_t* Add_pstrPins,\
+									uint8_t Copy_u8Width);
+
+
+
+/****************************************************************************************/
+/*								Inline Functions' Implementation						*/
+/****************************************************************************************/
+
+
+/**
+ *@brief  : Set a pin to be Logic HIGH (one store to the BSRR).
+ *@param  : Address of the pin's handle, filled by GPIO_enuInitPinHandle.
+ *@return : void.
+ */
+static inline void GPIO_vSetPin(const GPIO_strPinHandle_t* Add_pstrPinHandle)
+{
+	*(Add_pstrPinHandle->BSRR) = Add_pstrPinHandle->setMask;
+}
+
+
+/**
+ *@brief  : Set a pin to be Logic LOW (one store to the BSRR).
+ *@param  : Address of the pin's handle, filled by GPIO_enuInitPinHandle.
+ *@return : void.
+ */
+static inline void GPIO_vClearPin(const GPIO_strPinHandle_t* Add_pstrPinHandle)
+{
+	*(Add_pstrPinHandle->BSRR) = Add_pstrPinHandle->resetMask;
+}
+
+
+/**
+ *@brief  : Set a pin to a value, with no branch.
+ *@param  : Address of the pin's handle, filled by GPIO_enuInitPinHandle, Pin's value (GPIO_PIN_VAL_LOW/HIGH).
+ *@return : void.
+ */
+static inline void GPIO_vWritePin(const GPIO_strPinHandle_t* Add_pstrPinHandle, uint32_t Copy_u32PinVal)
+{
+	/* HIGH keeps the set mask and LOW keeps the reset mask */
+	*(Add_pstrPinHandle->BSRR) = (Add_pstrPinHandle->setMask & (0UL - Copy_u32PinVal))\
+								| (Add_pstrPinHandle->resetMask & (Copy_u32PinVal - 1UL));
+}
+
+
+/**
+ *@brief  : Invert the output of a pin. The ODR is read then the BSRR is written, so an interrupt that
+ * 			changes the same pin in between is overwritten, the other pins of the port are never touched.
+ *@param  : Address of the pin's handle, filled by GPIO_enuInitPinHandle.
+ *@return : void.
+ */
+static inline void GPIO_vTogglePin(const GPIO_strPinHandle_t* Add_pstrPinHandle)
+{
+	uint32_t LOC_u32Odr = Add_pstrPinHandle->BSRR[GPIO_ODR_FROM_BSRR];
+
+	/* A high pin gets its reset bit and a low pin gets its set bit */
+	*(Add_pstrPinHandle->BSRR) = ((LOC_u32Odr & Add_pstrPinHandle->setMask) << GPIO_BSRR_RESET_SHIFT)\
+								| (~LOC_u32Odr & Add_pstrPinHandle->setMask);
+}
+
+
+/**
+ *@brief  : Read the Logic State of a pin (one load of the IDR).
+ *@param  : Address of the pin's handle, filled by GPIO_enuInitPinHandle.
+ *@return : GPIO_PIN_VAL_LOW or GPIO_PIN_VAL_HIGH.
+ */
+static inline uint32_t GPIO_u32ReadPin(const GPIO_strPinHandle_t* Add_pstrPinHandle)
+{
+	return ((Add_pstrPinHandle->BSRR[GPIO_IDR_FROM_BSRR] & Add_pstrPinHandle->setMask) != 0) ?\
+			GPIO_PIN_VAL_HIGH : GPIO_PIN_VAL_LOW;
+}
+
+
+/**
+ *@brief  : Put a value on a parallel bus, one table read for each nibble of the bus and one store to the
+ * 			BSRR of each of its ports, so the lines of a port change at the same instant.
+ *@param  : Address of the bus, filled by GPIO_enuInitBus, the value (the bits above the bus are ignored).
+ *@return : void.
+ */
+static inline void GPIO_vWriteBus(const GPIO_strBus_t* Add_pstrBus, uint32_t Copy_u32Value)
+{
+	uint32_t LOC_u32Port;
+	uint32_t LOC_u32Nibble;
+	uint32_t LOC_u32BSRRWord;
+
+	for (LOC_u32Port = 0; LOC_u32Port < Add_pstrBus->portsNumber; LOC_u32Port++)
+	{
+		LOC_u32BSRRWord = 0;
+
+		for (LOC_u32Nibble = 0; LOC_u32Nibble < Add_pstrBus->nibblesNumber; LOC_u32Nibble++)
+		{
+			LOC_u32BSRRWord |= Add_pstrBus->BSRRTable[LOC_u32Port][LOC_u32Nibble]\
+								[(Copy_u32Value >> (LOC_u32Nibble * GPIO_BUS_NIBBLE_BITS)) & GPIO_BUS_NIBBLE_MASK];
+		}
+
+		*(Add_pstrBus->BSRR[LOC_u32Port]) = LOC_u32BSRRWord;
+	}
+}
+
 
 
 #endif /* GPIO_INTERFACE_H_ */
@@ -80,6 +80,16 @@
 #define SUBPRIORITY_LEVEL_15				(15)
 
 
+/* System handlers that have a configurable priority (their exception numbers) */
+#define SYSTEM_HANDLER_MEMMANAGE			(4)
+#define SYSTEM_HANDLER_BUSFAULT				(5)
+#define SYSTEM_HANDLER_USAGEFAULT			(6)
+#define SYSTEM_HANDLER_SVCALL				(11)
+#define SYSTEM_HANDLER_DEBUGMON				(12)
+#define SYSTEM_HANDLER_PENDSV				(14)
+#define SYSTEM_HANDLER_SYSTICK				(15)
+
+
 /* Priority Group Options */
 /* PG stands for Priority Group, GPB stands for Group Priority Bits, and SPB stands for SubPriority Bits */
 
@@ -232,4 +242,23 @@ NVIC_enuErrorStatus_t NVIC_SetPriorityGrouping(uint32_t priorityGroup);
 NVIC_enuErrorStatus_t NVIC_GetPriorityGrouping(uint32_t* priorityGroup);
 
 
+/**
+ *@brief : Function to set the priority for a system handler.
+ *@param : System handler (SYSTEM_HANDLER_MEMMANAGE, SYSTEM_HANDLER_BUSFAULT, SYSTEM_HANDLER_USAGEFAULT,
+ * 			SYSTEM_HANDLER_SVCALL, SYSTEM_HANDLER_DEBUGMON, SYSTEM_HANDLER_PENDSV or SYSTEM_HANDLER_SYSTICK).
+ *@param : Preemption level.
+ *@param : SubPriority level.
+ *@return: Error status.
+ */
+NVIC_enuErrorStatus_t NVIC_SetPrioritySystemHandler(uint8_t SYSTEM_HANDLER_, uint8_t PREEMPTION_LEVEL_, uint8_t SUBPRIORITY_LEVEL_);
+
+
+/**
+ *@brief : Function to set the pending bit for a system handler.
+ *@param : System handler (SYSTEM_HANDLER_PENDSV or SYSTEM_HANDLER_SYSTICK).
+ *@return: Error status.
+ */
+NVIC_enuErrorStatus_t NVIC_SetPendingSystemHandler(uint8_t SYSTEM_HANDLER_);
+
+
 #endif /* NVIC_INTERFACE_H_ */
@@ -64,7 +64,15 @@ typedef enum
 	/**
 	 *@brief : Unsupported delay time value passed to SYSTICK_SetTime function.
 	 */
-	SYSTICK_enuInvalidDelayValue
+	SYSTICK_enuInvalidDelayValue,
+	/**
+	 *@brief : The divider passed to SYSTICK_Subscribe is zero.
+	 */
+	SYSTICK_enuInvalidDivider,
+	/**
+	 *@brief : All the SYSTICK_SUBSCRIBERS_NUMBER subscribers are taken.
+	 */
+	SYSTICK_enuSubscribersFull
 }SYSTICK_enuErrorStatus_t;
 
 
@@ -109,12 +117,62 @@ SYSTICK_enuErrorStatus_t SYSTICK_SetTimeMilliSec(uint32_t DelayTime);
 
 
 /**
- *@brief : Function to set the call back function that the user entered.
+ *@brief : Function to set the call back function that the user entered, it's a subscriber of priority 0
+ * 			that runs every tick and replaces the one set before by this function.
  *@param : pointer to function that takes a void and returns void.
  *@return: Error status.
  */
 SYSTICK_enuErrorStatus_t SYSTICK_SetCallBack(sysTickCBF_t LOC_CallBackFunction);
 
 
+/**
+ *@brief : Function to add a call back to the subscribers of the SysTick interrupt. The handler runs the
+ * 			subscribers in the order of their priorities (0 first, the same priority in the order they
+ * 			subscribed), each one once every "Divider" interrupts starting "Divider" interrupts from now.
+ * 			It must not be called from a subscriber.
+ *@param : The call back, the divider (from 1 up) and the priority (0 is the highest).
+ *@return: Error status.
+ */
+SYSTICK_enuErrorStatus_t SYSTICK_Subscribe(sysTickCBF_t CallBackFunction, uint32_t Divider, uint8_t Priority);
+
+
+/**
+ *@brief : Function to remove a call back from the subscribers of the SysTick interrupt. It must not be
+ * 			called from a subscriber.
+ *@param : The call back.
+ *@return: Error status, SYSTICK_enuNotOk if it isn't subscribed.
+ */
+SYSTICK_enuErrorStatus_t SYSTICK_Unsubscribe(sysTickCBF_t CallBackFunction);
+
+
+/**
+ *@brief : Function to get the time spent in the SysTick handler with all its subscribers, from the
+ * 			interrupt to the end of the last subscriber, measured by the SysTick itself (in units of its
+ * 			clock, 1 or 8 core cycles). It's measured in periodic mode only and it must be shorter than a
+ * 			period.
+ *@param : Addresses to return the time of the last interrupt and the longest one in core clock cycles.
+ *@return: Error status.
+ */
+SYSTICK_enuErrorStatus_t SYSTICK_GetHandlerCycles(uint32_t* LastCycles, uint32_t* MaxCycles);
+
+
+/**
+ *@brief : Function to get the time counted by the SysTick since the first start in core clock cycles,
+ * 			it doesn't count while the SysTick is stopped. It's lock-free and safe to call from interrupts,
+ * 			except in the first instructions of the SysTick handler where it reads one period behind.
+ *@param : void.
+ *@return: The time in core clock cycles, it never wraps around.
+ */
+uint64_t SYSTICK_GetCycles(void);
+
+
+/**
+ *@brief : Function to get the time counted by the SysTick since the first start in microseconds.
+ *@param : void.
+ *@return: The time in microseconds, it never wraps around.
+ */
+uint64_t SYSTICK_GetTimeUs(void);
+
+
 
 #endif /* SYSTICK_INTERFACE_H_ */
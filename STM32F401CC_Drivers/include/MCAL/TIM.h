@@ -0,0 +1,139 @@
+/******************************************************************************
+*
+* Module: TIM Driver.
+*
+* File Name: TIM.h
+*
+* Description: Driver's APIs' prototypes and typedefs' declaration for the general purpose 32-bit
+* 				timers (TIM2 and TIM5) used as up counting time bases with an update interrupt.
+*
+* Author: Shaher Shah Abdalla Kamal
+*
+* Date:	17-10-2026
+*
+*******************************************************************************/
+
+#ifndef TIM_INTERFACE_H_
+#define TIM_INTERFACE_H_
+
+
+
+/****************************************************************************************/
+/*										Includes										*/
+/****************************************************************************************/
+
+#include <LIB/std_types.h>
+#include <CFG/TIM_cfg.h>
+
+
+
+/****************************************************************************************/
+/*									Macros Declaration									*/
+/****************************************************************************************/
+
+
+/* The 32-bit timers */
+#define TIM_TIMER2						(0x40000000UL)	/* 	TIM2 Base Address			*/
+#define TIM_TIMER5						(0x40000C00UL)	/* 	TIM5 Base Address			*/
+
+
+
+/****************************************************************************************/
+/*								User-defined types Declaration							*/
+/****************************************************************************************/
+
+
+/**
+ *@brief : The Error List Type
+ */
+typedef enum
+{
+	/**
+	 *@brief : Everything OK, function had Performed Correctly.
+	 */
+	TIM_enuOk = 0,
+	/**
+	 *@brief : Something went wrong in the function.
+	 */
+	TIM_enuNotOk,
+	/**
+	 *@brief : Null pointer is passed to a function as an argument.
+	 */
+	TIM_enuNullPointer,
+	/**
+	 *@brief : The passed timer is not TIM_TIMER2 or TIM_TIMER5.
+	 */
+	TIM_enuInvalidTimer,
+	/**
+	 *@brief : Unsupported period value passed to TIM_enuSetPeriodMicroSec function.
+	 */
+	TIM_enuInvalidPeriodValue
+
+}TIM_enuErrorStatus_t;
+
+/* The type of the call back function of the update interrupt */
+typedef void (*timCBF_t)(void);
+
+
+
+/****************************************************************************************/
+/*									Functions' Declaration								*/
+/****************************************************************************************/
+
+
+/**
+ *@brief : Function to enable the clock of a timer and configure it to count microseconds up, with
+ * 			its period buffered (a new period is used from the next update) and its update interrupt
+ * 			enabled. The IRQ (IRQ_TIM2 or IRQ_TIM5) still needs to be enabled in the NVIC.
+ *@param : The timer (TIM_TIMER2 or TIM_TIMER5).
+ *@return: Error status.
+ */
+TIM_enuErrorStatus_t TIM_enuInit(uint32_t Copy_u32Timer);
+
+
+/**
+ *@brief : Function to set the period of the update interrupt. While the timer counts, the running
+ * 			period isn't affected and the new one starts at the next update with no time lost.
+ *@param : The timer (TIM_TIMER2 or TIM_TIMER5).
+ *@param : The period in microseconds (from 1 up to 2^32 - 1).
+ *@return: Error status.
+ */
+TIM_enuErrorStatus_t TIM_enuSetPeriodMicroSec(uint32_t Copy_u32Timer, uint32_t Copy_u32PeriodUS);
+
+
+/**
+ *@brief : Function to start the timer from zero with the last set period.
+ *@param : The timer (TIM_TIMER2 or TIM_TIMER5).
+ *@return: Error status.
+ */
+TIM_enuErrorStatus_t TIM_enuStart(uint32_t Copy_u32Timer);
+
+
+/**
+ *@brief : Function to stop the timer.
+ *@param : The timer (TIM_TIMER2 or TIM_TIMER5).
+ *@return: Error status.
+ */
+TIM_enuErrorStatus_t TIM_enuStop(uint32_t Copy_u32Timer);
+
+
+/**
+ *@brief : Function to get the microseconds counted in the running period.
+ *@param : The timer (TIM_TIMER2 or TIM_TIMER5).
+ *@param : Pointer to the variable in which the counter will be assigned.
+ *@return: Error status.
+ */
+TIM_enuErrorStatus_t TIM_enuGetCounter(uint32_t Copy_u32Timer, uint32_t* Add_pu32Counter);
+
+
+/**
+ *@brief : Function to set the call back function that is called at every update of the timer.
+ *@param : The timer (TIM_TIMER2 or TIM_TIMER5).
+ *@param : pointer to function that takes a void and returns void.
+ *@return: Error status.
+ */
+TIM_enuErrorStatus_t TIM_enuSetCallBack(uint32_t Copy_u32Timer, timCBF_t Copy_CallBackFunction);
+
+
+
+#endif /* TIM_INTERFACE_H_ */
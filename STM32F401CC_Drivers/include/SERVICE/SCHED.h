@@ -24,6 +24,77 @@
 
 #include <LIB/std_types.h>
 #include <CFG/SCHED_Runnables_cfg.h>
+#include <CFG/SCHED_cfg.h>
+
+
+
+/************************************************************************************/
+/*								Macros Declaration									*/
+/************************************************************************************/
+
+
+/* Scheduler tickless mode options */
+#define SCHED_TICKLESS_DISABLE			0
+#define SCHED_TICKLESS_ENABLE			1
+
+/* Scheduler profiling options */
+#define SCHED_PROFILING_DISABLE			0
+#define SCHED_PROFILING_ENABLE			1
+
+/* Scheduler catch-up policy options */
+#define SCHED_CATCHUP_RUN_ALL			0
+#define SCHED_CATCHUP_COALESCE			1
+#define SCHED_CATCHUP_SKIP				2
+
+/* Scheduler dispatch policy options */
+#define SCHED_DISPATCH_FIXED_PRIORITY	0
+#define SCHED_DISPATCH_EDF				1
+
+/* Scheduler timing health options */
+#define SCHED_TIMING_HEALTH_DISABLE		0
+#define SCHED_TIMING_HEALTH_ENABLE		1
+
+/* Scheduler trace options */
+#define SCHED_TRACE_DISABLE				0
+#define SCHED_TRACE_ENABLE				1
+
+/* Types of the trace records */
+#define SCHED_TRACE_RUNNABLE_BEGIN		0
+#define SCHED_TRACE_RUNNABLE_END		1
+#define SCHED_TRACE_ISR_BEGIN			2
+#define SCHED_TRACE_ISR_END				3
+
+/* The id of the scheduler's tick interrupt in the trace, the other interrupts use their IRQ number */
+#define SCHED_TRACE_TICK_ISR			0xFFFF
+
+/* Scheduler preemptive mode options */
+#define SCHED_PREEMPTIVE_DISABLE		0
+#define SCHED_PREEMPTIVE_ENABLE			1
+
+/* Scheduler cyclic executive mode options */
+#define SCHED_CYCLIC_EXECUTIVE_DISABLE	0
+#define SCHED_CYCLIC_EXECUTIVE_ENABLE	1
+
+/* Scheduler multi-mode options */
+#define SCHED_MULTI_MODE_DISABLE		0
+#define SCHED_MULTI_MODE_ENABLE			1
+
+/* Scheduler time base options */
+#define SCHED_TIME_BASE_SYSTICK			0
+#define SCHED_TIME_BASE_TIM2			1
+#define SCHED_TIME_BASE_TIM5			2
+
+/* Runnable activation options */
+#define SCHED_ACTIVATION_PERIODIC		0
+#define SCHED_ACTIVATION_EVENT			1
+
+/* Convert a time to scheduler's ticks for SCHED_sleepCurrent and SCHED_CO_SLEEP, rounded up so a
+ * sleep is never shorter than the time asked for */
+#define SCHED_US_TO_TICKS(US)			(((uint32_t)(US) + SCHED_TICK_US - 1) / SCHED_TICK_US)
+#define SCHED_MS_TO_TICKS(MS)			SCHED_US_TO_TICKS((uint32_t)(MS) * 1000UL)
+
+/* Number of the runnables the scheduler holds, the ones of "arrayOfRunnables" then the dynamic slots */
+#define SCHED_RUNNABLES_CAPACITY		(_RunnablesNumber_ + SCHED_DYNAMIC_SLOTS)
 
 
 
@@ -31,19 +102,162 @@
 /*							User-defined types Declaration							*/
 /************************************************************************************/
 
+/**
+ *@brief : The Error List Type
+ */
+typedef enum
+{
+	/**
+	 *@brief : Everything OK, function had Performed Correctly.
+	 */
+	SCHED_enuOk = 0,
+	/**
+	 *@brief : Something went wrong in the function.
+	 */
+	SCHED_enuNotOk,
+	/**
+	 *@brief : Null pointer is passed to a function as an argument.
+	 */
+	SCHED_enuNullPointer,
+	/**
+	 *@brief : The event doesn't belong to any runnable.
+	 */
+	SCHED_enuInvalidEvent,
+	/**
+	 *@brief : The event queue is full, the event is dropped.
+	 */
+	SCHED_enuEventQueueFull,
+	/**
+	 *@brief : The mode is not in "ModesList_t".
+	 */
+	SCHED_enuInvalidMode,
+	/**
+	 *@brief : The runnable is not in the scheduler or it can't be changed this way.
+	 */
+	SCHED_enuInvalidRunnable,
+	/**
+	 *@brief : The period is shorter than the scheduler's tick.
+	 */
+	SCHED_enuInvalidPeriod,
+	/**
+	 *@brief : All the dynamic slots are taken.
+	 */
+	SCHED_enuNoFreeSlot
+
+}SCHED_enuErrorStatus_t;
+
 /* The type of the call back function in the runnable, function that takes nothing (void)
  * and returns nothing (void) */
 typedef void (*runnableCB_t)(void);
 
 /* Structure that includes the necessary data for each runnable, You will need to define
- * each of these three members for each runnable in the array */
+ * each of these members for each runnable in the array */
 typedef struct{
 	char* name;
-	uint32_t periodicityMS;
-	uint32_t firstDelay;
+	/* The runnable runs every "periodicityUS" microseconds */
+	uint32_t periodicityUS;
+	/* The first run of the runnable is after "firstDelayUS" microseconds from starting the scheduler */
+	uint32_t firstDelayUS;
 	runnableCB_t callBackFn;
+	/* Used in preemptive mode only: 0 runs in the main loop, from 1 up to SCHED_PREEMPTIVE_LEVELS
+	 * preempts the lower priorities. Runnables of the same priority run in the order of the array */
+	uint8_t priority;
+	/* SCHED_ACTIVATION_PERIODIC (the default) or SCHED_ACTIVATION_EVENT: an event runnable ignores
+	 * "periodicityUS" and "firstDelayUS" and runs once for each SCHED_postEvent with its index */
+	uint8_t activation;
+	/* Measured worst case execution time in microseconds (maxCycles of SCHED_getStats divided by the
+	 * core clock in MHz), not used by the scheduler itself but by tools/SCHED_planner that chooses
+	 * the "firstDelayUS" of each runnable */
+	uint32_t wcetUS;
 }runnable_t;
 
+#if (SCHED_MULTI_MODE == SCHED_MULTI_MODE_ENABLE)
+/* Structure that includes the runnables of each mode, You will need to define it for each mode in
+ * the array "arrayOfModes" */
+typedef struct{
+	char* name;
+	/* The runnables of the mode (indices of "arrayOfRunnables"), ended by _RunnablesNumber_ */
+	const RunnablesList_t* runnables;
+}SCHED_strMode_t;
+#endif
+
+#if (SCHED_PROFILING_MODE == SCHED_PROFILING_ENABLE)
+/* Execution time of one runnable in core clock cycles */
+typedef struct{
+	/* Number of times the runnable has run */
+	uint32_t runsCount;
+	uint32_t lastCycles;
+	uint32_t minCycles;
+	uint32_t maxCycles;
+	uint32_t meanCycles;
+}SCHED_strRunnableStats_t;
+
+/* Profiling data of the whole scheduler since SCHED_init or the last SCHED_resetStats */
+typedef struct{
+	/* Indexed the same as "arrayOfRunnables", then the dynamic slots */
+	SCHED_strRunnableStats_t runnables[SCHED_RUNNABLES_CAPACITY];
+	/* Cycles consumed by the last scheduler's tick (dispatching and all the runnables in it) */
+	uint32_t lastTickCycles;
+	/* Cycles consumed by the longest scheduler's tick */
+	uint32_t maxTickCycles;
+	/* Part of the CPU time consumed by the scheduler's ticks, from 0 to 1000 */
+	uint32_t cpuLoadPermille;
+}SCHED_strStats_t;
+#endif
+
+#if (SCHED_TIMING_HEALTH_MODE == SCHED_TIMING_HEALTH_ENABLE)
+/* Timing health of one runnable */
+typedef struct{
+	/* Number of releases that were not served in their own tick (run late or dropped) */
+	uint32_t deadlineMisses;
+	/* The longest delay from a release until the runnable started, in core clock cycles */
+	uint32_t maxJitterCycles;
+	/* Bucket (i) counts the runs that started between (i * SCHED_JITTER_BUCKET_US) and
+	 * ((i + 1) * SCHED_JITTER_BUCKET_US) microseconds after their release, the last bucket
+	 * counts all the later ones */
+	uint32_t jitterHistogram[SCHED_JITTER_BUCKETS];
+}SCHED_strRunnableHealth_t;
+
+/* Timing health of the whole scheduler since SCHED_init or the last SCHED_resetHealth */
+typedef struct{
+	/* Indexed the same as "arrayOfRunnables", then the dynamic slots */
+	SCHED_strRunnableHealth_t runnables[SCHED_RUNNABLES_CAPACITY];
+	/* Number of times the main loop found more than one tick to catch up */
+	uint32_t backlogEvents;
+	/* The largest number of ticks the main loop was behind */
+	uint32_t maxBacklogTicks;
+}SCHED_strHealth_t;
+#endif
+
+#if (SCHED_TRACE_MODE == SCHED_TRACE_ENABLE)
+/* One record of the trace */
+typedef struct{
+	/* The DWT cycle counter when it was recorded */
+	uint32_t cycles;
+	/* The index of the runnable, or the IRQ number of the interrupt */
+	uint16_t id;
+	/* From SCHED_TRACE_RUNNABLE_BEGIN to SCHED_TRACE_ISR_END */
+	uint8_t type;
+	uint8_t reserved;
+}SCHED_strTraceRecord_t;
+
+/* The trace ring as it's laid out in RAM, little endian */
+typedef struct{
+	/* SCHED_TRACE_MAGIC, tools/SCHED_trace finds the start of the ring in a dump by it */
+	uint32_t magic;
+	/* SCHED_TRACE_RECORDS */
+	uint32_t recordsNumber;
+	/* The core clock in MHz, to convert the cycles to time */
+	uint32_t cyclesPerUs;
+	/* Number of records written since SCHED_init, it wraps around. The next record is written at
+	 * (head % recordsNumber), so it's the oldest one once the ring is full */
+	volatile uint32_t head;
+	/* Zero while the recording is stopped by SCHED_stopTrace */
+	volatile uint32_t recording;
+	SCHED_strTraceRecord_t records[SCHED_TRACE_RECORDS];
+}SCHED_strTrace_t;
+#endif
+
 
 
 /************************************************************************************/
@@ -52,11 +266,12 @@ typedef struct{
 
 
 /**
- *@brief : Function that initializes the scheduler.
+ *@brief : Function that initializes the scheduler. In preemptive mode it sets the NVIC priority group to
+ * 			give all the priority bits to the preemption levels.
  *@param : void.
- *@return: void.
+ *@return: Error status, don't call SCHED_start if it's not SCHED_enuOk.
  */
-void SCHED_init(void);
+SCHED_enuErrorStatus_t SCHED_init(void);
 
 
 /**
@@ -67,5 +282,193 @@ void SCHED_init(void);
 void SCHED_start(void);
 
 
+/**
+ *@brief : Function that releases an event runnable, it runs on the next iteration of the scheduler.
+ * 			It's safe to call from an interrupt, but all the callers must have the same preemption
+ * 			level as the queue has a single producer.
+ *@param : The event, the index of the runnable in "arrayOfRunnables".
+ *@return: Error status.
+ */
+SCHED_enuErrorStatus_t SCHED_postEvent(RunnablesList_t Copy_enuEvent);
+
+
+/**
+ *@brief : Function that gets the current time of the scheduler, the tick of the running release.
+ *@param : void.
+ *@return: The time in scheduler's ticks, it wraps around.
+ */
+uint32_t SCHED_getTime(void);
+
+
+/**
+ *@brief : Function that stops releasing the running periodic runnable for a number of ticks, its next
+ * 			release is after them and its period goes on from there. It's a hint only: in preemptive and
+ * 			cyclic executive modes, and for event runnables, it does nothing and the runnable is
+ * 			released as usual, so the runnable has to check the time by itself as SCHED_CO_SLEEP does.
+ *@param : Number of ticks from the current one, zero does nothing.
+ *@return: void.
+ */
+void SCHED_sleepCurrent(uint32_t Copy_u32Ticks);
+
+
+#if (SCHED_CYCLIC_EXECUTIVE_MODE == SCHED_CYCLIC_EXECUTIVE_DISABLE)
+/**
+ *@brief : Function that changes the period of a periodic runnable, the release that is already
+ * 			planned isn't moved and the new period goes on from it. A runnable of "arrayOfRunnables"
+ * 			gets its configured period again when a mode starts. It's safe to call from a runnable
+ * 			(even for itself) or an interrupt.
+ *@param : The runnable, from "RunnablesList_t" or given by SCHED_addRunnable.
+ *@param : The new period in microseconds, rounded down to whole ticks.
+ *@return: Error status.
+ */
+SCHED_enuErrorStatus_t SCHED_setPeriod(uint32_t Copy_u32Runnable, uint32_t Copy_u32PeriodUS);
+#endif
+
+
+#if (SCHED_DYNAMIC_SLOTS > 0)
+/**
+ *@brief : Function that adds a runnable in a free dynamic slot, the runnable is copied so it can be
+ * 			built on the stack. Its first release is "firstDelayUS" after the running tick, and an event
+ * 			runnable gets the events posted with the given index. It's safe to call from a runnable, and
+ * 			from an interrupt in preemptive mode only (the main loop changes the wheel in the other modes).
+ *@param : Pointer to the runnable.
+ *@param : Pointer in which the index of the runnable in the scheduler is assigned.
+ *@return: Error status.
+ */
+SCHED_enuErrorStatus_t SCHED_addRunnable(const runnable_t* Add_pstrRunnable, uint32_t* Add_pu32Runnable);
+
+
+/**
+ *@brief : Function that removes a runnable added by SCHED_addRunnable and frees its slot, it's never
+ * 			released again. It's safe to call from a runnable (even for itself), and from an interrupt in
+ * 			preemptive mode only.
+ *@param : The index given by SCHED_addRunnable.
+ *@return: Error status.
+ */
+SCHED_enuErrorStatus_t SCHED_removeRunnable(uint32_t Copy_u32Runnable);
+#endif
+
+
+#if (SCHED_MULTI_MODE == SCHED_MULTI_MODE_ENABLE)
+/**
+ *@brief : Function that asks the scheduler to switch to another mode at the next end of the hyperperiod
+ * 			of the current mode. It's safe to call from a runnable or an interrupt, a later request
+ * 			replaces a request that hasn't been served yet and requesting the current mode cancels it.
+ *@param : The mode, from "ModesList_t".
+ *@return: Error status.
+ */
+SCHED_enuErrorStatus_t SCHED_requestMode(ModesList_t Copy_enuMode);
+
+
+/**
+ *@brief : Function that gets the mode the scheduler is running now.
+ *@param : void.
+ *@return: The current mode.
+ */
+ModesList_t SCHED_getMode(void);
+#endif
+
+
+#if (SCHED_PROFILING_MODE == SCHED_PROFILING_ENABLE)
+/**
+ *@brief : Function that gets the execution time measurements of the runnables, call it from a runnable.
+ *@param : Pointer to the structure in which the measurements will be assigned.
+ *@return: Error status.
+ */
+SCHED_enuErrorStatus_t SCHED_getStats(SCHED_strStats_t* Add_pstrStats);
+
+
+/**
+ *@brief : Function that clears the execution time measurements and starts measuring again from now,
+ * 			call it from a runnable.
+ *@param : void.
+ *@return: void.
+ */
+void SCHED_resetStats(void);
+#endif
+
+
+#if (SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_ENABLE)
+/**
+ *@brief : Function that raises the running priority to the ceiling of a resource (the highest priority
+ * 			of the runnables that use it), so none of them can preempt until SCHED_unlockCeiling.
+ *@param : The ceiling priority, from 1 up to SCHED_PREEMPTIVE_LEVELS.
+ *@return: The previous running priority, to be passed to SCHED_unlockCeiling.
+ */
+uint32_t SCHED_lockCeiling(uint8_t Copy_u8Ceiling);
+
+
+/**
+ *@brief : Function that gets back the running priority from before SCHED_lockCeiling.
+ *@param : The value returned by SCHED_lockCeiling.
+ *@return: void.
+ */
+void SCHED_unlockCeiling(uint32_t Copy_u32Previous);
+#endif
+
+
+#if (SCHED_TIMING_HEALTH_MODE == SCHED_TIMING_HEALTH_ENABLE)
+/**
+ *@brief : Function that gets the timing health of the scheduler and its runnables, call it from a runnable.
+ *@param : Pointer to the structure in which the timing health will be assigned.
+ *@return: Error status.
+ */
+SCHED_enuErrorStatus_t SCHED_getHealth(SCHED_strHealth_t* Add_pstrHealth);
+
+
+/**
+ *@brief : Function that clears the timing health counters and histograms, call it from a runnable.
+ *@param : void.
+ *@return: void.
+ */
+void SCHED_resetHealth(void);
+#endif
+
+
+#if (SCHED_TRACE_MODE == SCHED_TRACE_ENABLE)
+/**
+ *@brief : Function that records the start of an interrupt handler in the trace, call it first in the handler.
+ *@param : The IRQ number of the interrupt, from "IRQs_t".
+ *@return: void.
+ */
+void SCHED_traceIsrEnter(uint32_t Copy_u32Irq);
+
+
+/**
+ *@brief : Function that records the end of an interrupt handler in the trace, call it last in the handler.
+ *@param : The IRQ number of the interrupt, the same as SCHED_traceIsrEnter.
+ *@return: void.
+ */
+void SCHED_traceIsrExit(uint32_t Copy_u32Irq);
+
+
+/**
+ *@brief : Function that stops recording the trace, so the ring can be read while the scheduler runs.
+ *@param : void.
+ *@return: void.
+ */
+void SCHED_stopTrace(void);
+
+
+/**
+ *@brief : Function that starts recording the trace again after SCHED_stopTrace, the new records
+ * 			overwrite the oldest ones. The recording starts by itself in SCHED_init.
+ *@param : void.
+ *@return: void.
+ */
+void SCHED_startTrace(void);
+
+
+/**
+ *@brief : Function that gets the trace ring as bytes (a "SCHED_strTrace_t"), to send them over a UART
+ * 			as they are to tools/SCHED_trace/SCHED_trace.py. Stop the trace first.
+ *@param : Pointer in which the address of the ring is assigned.
+ *@param : Pointer in which the size of the ring in bytes is assigned.
+ *@return: Error status.
+ */
+SCHED_enuErrorStatus_t SCHED_getTrace(const uint8_t** Add_ppu8Trace, uint32_t* Add_pu32Size);
+#endif
+
+
 
 #endif /* SCHED_INTERFACE_H_ */
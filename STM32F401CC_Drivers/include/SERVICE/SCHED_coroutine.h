@@ -0,0 +1,116 @@
+/******************************************************************************
+*
+* Module: Scheduler Driver.
+*
+* File Name: SCHED_coroutine.h
+*
+* Description: Stackless coroutines for the runnables that do a job in many steps.
+* 				A coroutine is a void function written as straight-line code between
+* 				SCHED_CO_BEGIN and SCHED_CO_END, it returns at each yield, sleep or wait
+* 				and the next call continues after it. Only the resume point and a wake
+* 				up tick are kept (SCHED_strCoroutine_t), so:
+* 				- Local variables are lost at each return, use static ones instead.
+* 				- A yield, sleep or wait can't be inside a switch statement of the coroutine.
+* 				- Only one coroutine can be between SCHED_CO_BEGIN and SCHED_CO_END of a function.
+*
+* 				e.g.
+* 				static SCHED_strCoroutine_t alarmCo;
+* 				void RUNNABLE_Alarm(void)
+* 				{
+* 					SCHED_CO_BEGIN(&alarmCo);
+* 					SCHED_CO_WAIT_UNTIL(&alarmCo, alarmFlag != 0);
+* 					LED_enuPowerON(ALARM_LED);
+* 					SCHED_CO_SLEEP(&alarmCo, 100);
+* 					LED_enuPowerOFF(ALARM_LED);
+* 					SCHED_CO_END(&alarmCo);
+* 				}
+*
+* Author: Shaher Shah Abdalla Kamal
+*
+* Date:	17-10-2026
+*
+*******************************************************************************/
+
+
+#ifndef SCHED_COROUTINE_H_
+#define SCHED_COROUTINE_H_
+
+
+/************************************************************************************/
+/*									Includes										*/
+/************************************************************************************/
+
+
+#include <SERVICE/SCHED.h>
+
+
+
+/************************************************************************************/
+/*								Macros Declaration									*/
+/************************************************************************************/
+
+
+/**
+ *@brief : Starts the body of a coroutine, it jumps to where the coroutine returned last time.
+ *@param : Pointer to the coroutine's state.
+ */
+#define SCHED_CO_BEGIN(Add_pstrCo)					switch ((Add_pstrCo)->resumePoint) { case 0:
+
+/**
+ *@brief : Returns from the coroutine, the next call continues after this line.
+ *@param : Pointer to the coroutine's state.
+ */
+#define SCHED_CO_YIELD(Add_pstrCo)					do { (Add_pstrCo)->resumePoint = __LINE__; return; case __LINE__:; } while (0)
+
+/**
+ *@brief : Returns from the coroutine until the condition is true, it's checked at every call (including
+ * 			this one) so the coroutine doesn't return at all if the condition is already true.
+ *@param : Pointer to the coroutine's state.
+ *@param : The condition, an expression of the driver's flags or states.
+ */
+#define SCHED_CO_WAIT_UNTIL(Add_pstrCo, Condition)	do { if (!(Condition)) { (Add_pstrCo)->resumePoint = __LINE__; return; case __LINE__:\
+														if (!(Condition)) { return; } } } while (0)
+
+/**
+ *@brief : Returns from the coroutine for a number of scheduler's ticks. The scheduler doesn't release
+ * 			the runnable at all until they pass when it can (see SCHED_sleepCurrent), otherwise the
+ * 			coroutine only compares the time at each call.
+ *@param : Pointer to the coroutine's state.
+ *@param : Number of ticks, from 1 and more.
+ */
+#define SCHED_CO_SLEEP(Add_pstrCo, Ticks)			do { (Add_pstrCo)->wakeTick = SCHED_getTime() + (Ticks);\
+														SCHED_sleepCurrent(Ticks);\
+														(Add_pstrCo)->resumePoint = __LINE__; return; case __LINE__:\
+														if ((sint32_t)(SCHED_getTime() - (Add_pstrCo)->wakeTick) < 0) { return; } } while (0)
+
+/**
+ *@brief : Ends the body of a coroutine, the next call starts it again from SCHED_CO_BEGIN.
+ *@param : Pointer to the coroutine's state.
+ */
+#define SCHED_CO_END(Add_pstrCo)					} (Add_pstrCo)->resumePoint = 0
+
+/**
+ *@brief : Makes the next call start the coroutine again from SCHED_CO_BEGIN, it can be called from
+ * 			outside the coroutine to cancel it.
+ *@param : Pointer to the coroutine's state.
+ */
+#define SCHED_CO_RESET(Add_pstrCo)					do { (Add_pstrCo)->resumePoint = 0; } while (0)
+
+
+
+/************************************************************************************/
+/*							User-defined types Declaration							*/
+/************************************************************************************/
+
+
+/* The state of a coroutine, define one static object for each coroutine initialized by zero */
+typedef struct{
+	/* The line to continue from, zero is the beginning */
+	uint16_t resumePoint;
+	/* The tick at which the running SCHED_CO_SLEEP ends */
+	uint32_t wakeTick;
+}SCHED_strCoroutine_t;
+
+
+
+#endif /* SCHED_COROUTINE_H_ */
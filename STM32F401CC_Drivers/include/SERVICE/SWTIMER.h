@@ -0,0 +1,192 @@
+/******************************************************************************
+*
+* Module: Software Timers Service.
+*
+* File Name: SWTIMER.h
+*
+* Description: Service's APIs' prototypes and typedefs' declaration, one-shot and periodic software
+* 				timers on a hierarchical timing wheel driven by one hardware tick.
+*
+* Author: Shaher Shah Abdalla Kamal
+*
+* Date:	17-10-2026
+*
+*******************************************************************************/
+
+
+#ifndef SWTIMER_INTERFACE_H_
+#define SWTIMER_INTERFACE_H_
+
+
+/************************************************************************************/
+/*									Includes										*/
+/************************************************************************************/
+
+
+#include <LIB/std_types.h>
+#include <CFG/SWTIMER_cfg.h>
+
+
+
+/************************************************************************************/
+/*								Macros Declaration									*/
+/************************************************************************************/
+
+
+/* Software timers time base options */
+#define SWTIMER_TIME_BASE_SYSTICK		0
+#define SWTIMER_TIME_BASE_TIM2			1
+#define SWTIMER_TIME_BASE_TIM5			2
+#define SWTIMER_TIME_BASE_EXTERNAL		3
+
+/* Deferred dispatch options */
+#define SWTIMER_DEFERRED_POLLING		0
+#define SWTIMER_DEFERRED_SCHED			1
+
+/* Where the call back of a timer runs */
+#define SWTIMER_DISPATCH_ISR			0
+#define SWTIMER_DISPATCH_DEFERRED		1
+
+
+
+/************************************************************************************/
+/*							User-defined types Declaration							*/
+/************************************************************************************/
+
+/**
+ *@brief : The Error List Type
+ */
+typedef enum
+{
+	/**
+	 *@brief : Everything OK, function had Performed Correctly.
+	 */
+	SWTIMER_enuOk = 0,
+	/**
+	 *@brief : Something went wrong in the function.
+	 */
+	SWTIMER_enuNotOk,
+	/**
+	 *@brief : Null pointer is passed to a function as an argument.
+	 */
+	SWTIMER_enuNullPointer,
+	/**
+	 *@brief : The dispatch is not SWTIMER_DISPATCH_ISR or SWTIMER_DISPATCH_DEFERRED.
+	 */
+	SWTIMER_enuInvalidDispatch,
+	/**
+	 *@brief : The delay is zero or the delay or the period is longer than the wheel.
+	 */
+	SWTIMER_enuInvalidTime
+
+}SWTIMER_enuErrorStatus_t;
+
+/* The type of the call back function of a timer, it takes the context given to SWTIMER_create */
+typedef void (*swTimerCBF_t)(void* context);
+
+/* A link of the lists of the wheel */
+typedef struct SWTIMER_strLink
+{
+	struct SWTIMER_strLink* next;
+	struct SWTIMER_strLink* prev;
+}SWTIMER_strLink_t;
+
+/* A software timer, allocated by the application (as a static or global variable) and set up by
+ * SWTIMER_create. Its members are owned by the service, don't change them */
+typedef struct
+{
+	/* Must stay the first member, "next" is NULL while the timer isn't running */
+	SWTIMER_strLink_t link;
+	/* The tick of the next expiry */
+	uint32_t expiry;
+	/* Zero for a one-shot timer */
+	uint32_t periodTicks;
+	swTimerCBF_t callBackFn;
+	void* context;
+	uint8_t dispatch;
+	/* The expiry is waiting for SWTIMER_dispatchDeferred */
+	volatile uint8_t queued;
+}SWTIMER_strTimer_t;
+
+
+
+/************************************************************************************/
+/*								Functions' Declaration								*/
+/************************************************************************************/
+
+
+/**
+ *@brief : Function that initializes the wheel and starts the time base of the software timers.
+ *@param : void.
+ *@return: void.
+ */
+void SWTIMER_init(void);
+
+
+/**
+ *@brief : Function that sets up a timer, it must not be running.
+ *@param : The timer, its call back, the context passed to the call back and where the call back runs:
+ * 			SWTIMER_DISPATCH_ISR in the tick's interrupt (keep it short) or SWTIMER_DISPATCH_DEFERRED
+ * 			in SWTIMER_dispatchDeferred.
+ *@return: Error status.
+ */
+SWTIMER_enuErrorStatus_t SWTIMER_create(SWTIMER_strTimer_t* Add_pstrTimer, swTimerCBF_t Copy_CallBackFunction,
+										void* Add_pvContext, uint8_t Copy_u8Dispatch);
+
+
+/**
+ *@brief : Function that starts a timer, or restarts it if it's running. It expires at the tick that ends
+ * 			"delay" ticks from now (the first of them is the running tick, so it may expire up to one
+ * 			tick early), then every "period" if the period isn't zero. It takes a constant time and it's
+ * 			safe to call from an interrupt and from a call back.
+ *@param : The timer, the delay to the first expiry and the period in microseconds (0 for one-shot).
+ *@return: Error status.
+ */
+SWTIMER_enuErrorStatus_t SWTIMER_start(SWTIMER_strTimer_t* Add_pstrTimer, uint32_t Copy_u32DelayUS, uint32_t Copy_u32PeriodUS);
+
+
+/**
+ *@brief : Function that stops a timer, a deferred expiry that is still waiting is dropped. It takes a
+ * 			constant time and it's safe to call from an interrupt and from a call back.
+ *@param : The timer.
+ *@return: Error status.
+ */
+SWTIMER_enuErrorStatus_t SWTIMER_stop(SWTIMER_strTimer_t* Add_pstrTimer);
+
+
+/**
+ *@brief : Function that checks if a timer is running.
+ *@param : The timer.
+ *@return: 1 if it's running, 0 otherwise.
+ */
+uint8_t SWTIMER_isRunning(const SWTIMER_strTimer_t* Add_pstrTimer);
+
+
+/**
+ *@brief : Function that advances the wheel by one tick and expires its timers. It's the call back of
+ * 			the time base, call it once every SWTIMER_TICK_US with SWTIMER_TIME_BASE_EXTERNAL only.
+ *@param : void.
+ *@return: void.
+ */
+void SWTIMER_tick(void);
+
+
+/**
+ *@brief : Function that runs the call backs of the deferred timers that expired, from a single caller
+ * 			(the main loop or the runnable of SWTIMER_DEFERRED_SCHED).
+ *@param : void.
+ *@return: void.
+ */
+void SWTIMER_dispatchDeferred(void);
+
+
+/**
+ *@brief : Function that gets the number of deferred expiries that were merged into a waiting one
+ * 			or dropped because the queue was full.
+ *@param : void.
+ *@return: The number of missed expiries.
+ */
+uint32_t SWTIMER_getMissedExpiries(void);
+
+
+#endif /* SWTIMER_INTERFACE_H_ */
@@ -64,8 +64,14 @@ int main (void)
 	LCD_enuInitAsync(LCD_initDoneToggleLED);
 //	LCD_enuWriteStringAsync(str,LCD_writeDoneToggleLED);
 
-	SCHED_init();
-	SCHED_start();
+	if (SCHED_init() == SCHED_enuOk)
+	{
+		SCHED_start();
+	}
+	else
+	{
+		/* Do Nothing */
+	}
 
 	return 0;
 }
@@ -0,0 +1,185 @@
+/******************************************************************************
+ *
+ * File Name: SCHED_CyclicTable_cfg.c
+ *
+ * Description: Frame table of the scheduler's cyclic executive mode, generated by
+ * 				tools/SCHED_planner/SCHED_cyclic_gen.py from SCHED_Runnables_cfg.c.
+ * 				DO NOT EDIT it, run the generator again instead.
+ *
+ * 				Hyperperiod:	1000 frames of 1000 us
+ * 				Worst frame:	0 us (0.0 % of the frame) at frame 0, from the wcetUS of the runnables
+ *
+ * Author: Shaher Shah Abdalla Kamal
+ *
+ *******************************************************************************/
+
+
+
+/************************************************************************************/
+/*									Includes										*/
+/************************************************************************************/
+
+
+#include <SERVICE/SCHED.h>
+
+
+#if (SCHED_CYCLIC_EXECUTIVE_MODE == SCHED_CYCLIC_EXECUTIVE_ENABLE)
+
+
+
+/************************************************************************************/
+/*								extern Public Functions								*/
+/************************************************************************************/
+
+
+extern void RUNNABLE_LCD(void);
+extern void RUNNABLE_testLCD(void);
+extern void RUNNABLE_toggleLED(void);
+
+
+
+/************************************************************************************/
+/*								Variables's Definition								*/
+/************************************************************************************/
+
+
+/* The table is generated for this number of runnables, if the build stops here run the generator again */
+typedef char SCHED_cyclicTableIsOutdated [(_RunnablesNumber_ == 3) ? 1 : -1];
+
+/* The call backs of each distinct frame, ended by NULL_PTR */
+static const runnableCB_t frame0 [] = { RUNNABLE_LCD, NULL_PTR };
+static const runnableCB_t frame1 [] = { RUNNABLE_toggleLED, RUNNABLE_testLCD, RUNNABLE_LCD, NULL_PTR };
+
+/* The frame of each tick of the hyperperiod */
+const runnableCB_t* const SCHED_cyclicTable [1000] = {
+	/*     0 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*     8 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*    16 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*    24 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*    32 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*    40 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*    48 */ frame0, frame0, frame1, frame0, frame0, frame0, frame0, frame0,
+	/*    56 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*    64 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*    72 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*    80 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*    88 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*    96 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   104 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   112 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   120 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   128 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   136 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   144 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   152 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   160 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   168 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   176 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   184 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   192 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   200 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   208 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   216 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   224 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   232 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   240 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   248 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   256 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   264 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   272 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   280 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   288 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   296 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   304 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   312 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   320 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   328 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   336 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   344 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   352 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   360 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   368 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   376 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   384 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   392 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   400 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   408 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   416 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   424 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   432 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   440 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   448 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   456 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   464 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   472 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   480 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   488 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   496 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   504 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   512 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   520 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   528 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   536 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   544 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   552 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   560 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   568 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   576 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   584 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   592 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   600 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   608 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   616 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   624 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   632 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   640 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   648 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   656 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   664 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   672 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   680 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   688 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   696 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   704 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   712 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   720 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   728 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   736 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   744 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   752 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   760 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   768 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   776 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   784 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   792 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   800 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   808 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   816 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   824 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   832 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   840 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   848 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   856 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   864 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   872 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   880 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   888 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   896 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   904 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   912 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   920 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   928 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   936 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   944 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   952 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   960 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   968 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   976 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   984 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+	/*   992 */ frame0, frame0, frame0, frame0, frame0, frame0, frame0, frame0,
+};
+
+const uint32_t SCHED_cyclicFramesNumber = 1000;
+
+
+#endif
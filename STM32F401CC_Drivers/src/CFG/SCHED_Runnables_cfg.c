@@ -44,17 +44,31 @@ extern void RUNNABLE_LCD(void);
  * Example:
  * const runnable_t arrayOfRunnables [_RunnablesNumber_] = {
 	[Runnable1] = { .name = "Toggle LED each second",
-							.periodicityMS = 1000,
+							.periodicityUS = 1000000,
 							.callBackFn = RUNNABLE_LED_toggle
 	},
 	[Runnable2] = { .name = "Check the status of the switches",
-							.periodicityMS = 30,
+							.periodicityUS = 30000,
+							.wcetUS = 120,
 							.callBackFn = RUNNABLE_SWITCH_getSwitchState
 	},
+	[Runnable3] = { .name = "Handle a received frame",
+							.activation = SCHED_ACTIVATION_EVENT,
+							.callBackFn = RUNNABLE_UART_handleFrame
+	},
+	[Runnable4] = { .name = "Current control loop at 10 kHz",
+							.periodicityUS = 100,
+							.wcetUS = 25,
+							.callBackFn = RUNNABLE_MOTOR_currentLoop
+	},
 	and so on ...
+ * 				An event runnable runs when SCHED_postEvent(Runnable3) is called (from the UART ISR for example).
+ * 				Runnable4 needs SCHED_TICK_US of 100 (or a divisor of it), better with a timer time base.
 };
- * Cautions: 	- Be careful when setting the periodicity of any runnable that it's not
- * 					smaller than 10 ms.
+ * Cautions: 	- The periods and first delays are in microseconds, choose them as multiples of
+ * 					SCHED_TICK_US (in CFG/SCHED_cfg.h) as they are rounded down to whole ticks.
+ * 				- Run tools/SCHED_planner/SCHED_planner.py --write after measuring the "wcetUS"
+ * 					of the runnables to spread their "firstDelayUS" so they don't load the same tick.
  * 				- Note that the order in which You will write the runnables in the array defines
  * 					the priority for each of them, the priority decreases as the index of the runnable
  * 					increases (Runnable in index zero is the one with the highest priority).
@@ -62,30 +76,60 @@ extern void RUNNABLE_LCD(void);
 
 const runnable_t arrayOfRunnables [_RunnablesNumber_] = {
 	[toggleTheLED] 		= { .name = "Toggle LED each second",
-							.periodicityMS = 1000,
-							.firstDelay = 50,
+							.periodicityUS = 1000000,
+							.firstDelayUS = 50000,
 							.callBackFn = RUNNABLE_toggleLED
 	},
 	[testLCD] 		= { .name = "Test the LCD driver",
-							.periodicityMS = 1000,
-							.firstDelay = 50,
+							.periodicityUS = 1000000,
+							.firstDelayUS = 50000,
 							.callBackFn = RUNNABLE_testLCD
 	},
 //	[switchRunnable] 	= { .name = "Check the status of the switches",
-//							.periodicityMS = 30,
+//							.periodicityUS = 30000,
 //							.callBackFn = RUNNABLE_SWITCH_getSwitchState
 //	},
 //	[ctrlLED] 			= { .name = "Control a LED through a switch",
-//							.periodicityMS = 50,
+//							.periodicityUS = 50000,
 //							.callBackFn = RUNNABLE_ctrlLED
 //	},
 //	[trafficLightSM] 	= { .name = "Traffic light application",
-//							.periodicityMS = 1000,
+//							.periodicityUS = 1000000,
 //							.callBackFn = RUNNABLE_trafficLight_stateMachine
 //	},
 	[lcdRunnable] 		= { .name = "LCD module",
-							.periodicityMS = 1,
-							.firstDelay = 0,
+							.periodicityUS = 1000,
+							.firstDelayUS = 0,
 							.callBackFn = RUNNABLE_LCD
 	}
 };
+
+
+#if (SCHED_MULTI_MODE == SCHED_MULTI_MODE_ENABLE)
+/* Description: Create array of Modes in your system, listing inside each one the runnables that run in it
+ * 				ended by _RunnablesNumber_. A runnable may be listed in many modes.
+ * Example:
+ * const SCHED_strMode_t arrayOfModes [_ModesNumber_] = {
+	[startupMode] 	= { .name = "Initialize the LCD",
+						.runnables = (const RunnablesList_t []){ lcdRunnable, _RunnablesNumber_ }
+	},
+	[normalMode] 	= { .name = "Normal operation",
+						.runnables = (const RunnablesList_t []){ toggleTheLED, switchRunnable, lcdRunnable, _RunnablesNumber_ }
+	},
+	[lowPowerMode] 	= { .name = "Wait for a switch to be pressed",
+						.runnables = (const RunnablesList_t []){ switchRunnable, _RunnablesNumber_ }
+	},
+	and so on ...
+};
+ * Cautions: 	- A mode with a long hyperperiod (the least common multiple of its periods) switches late,
+ * 					choose the periods as multiples of each other.
+ * 				- In preemptive mode and with SCHED_DISPATCH_EDF, the releases made before the switch that
+ * 					haven't run yet still run.
+ * 																					*/
+
+const SCHED_strMode_t arrayOfModes [_ModesNumber_] = {
+	[normalMode] 		= { .name = "Normal operation",
+							.runnables = (const RunnablesList_t []){ toggleTheLED, testLCD, lcdRunnable, _RunnablesNumber_ }
+	}
+};
+#endif
@@ -23,6 +23,7 @@
 
 #include <MCAL/RCC.h>
 #include <MCAL/GPIO.h>
+#include <SERVICE/SCHED_coroutine.h>
 #include "HAL/LCD.h"
 
 
@@ -61,6 +62,47 @@ extern LCD_strLCDPinConfig_t arrayofLCDPinConfig [7];
 #define REMAINING_STAGES_4_BIT_MODE_CASE		9
 #define REMAINING_STAGES_8_BIT_MODE_CASE		6
 
+#if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE)
+#define LCD_WRITE_STAGES						REMAINING_STAGES_4_BIT_MODE_CASE
+#elif (LCD_DATA_BITS_MODE == LCD_EIGHT_BITS_MODE)
+#define LCD_WRITE_STAGES						REMAINING_STAGES_8_BIT_MODE_CASE
+#endif
+
+/* The indices of the control pins in "arrayofLCDPinConfig" and of the data pins, the first data pin
+ * carries the lowest bit of the value on the bus */
+#if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE)
+#define LCD_RS_PIN								RS_4BITMODE
+#define LCD_RW_PIN								RW_4BITMODE
+#define LCD_E_PIN								E_4BITMODE
+#define LCD_FIRST_DATA_PIN						D4_4BITMODE
+#define LCD_DATA_PINS_NUMBER					4
+#elif (LCD_DATA_BITS_MODE == LCD_EIGHT_BITS_MODE)
+#define LCD_RS_PIN								RS
+#define LCD_RW_PIN								RW
+#define LCD_E_PIN								E
+#define LCD_FIRST_DATA_PIN						D0
+#define LCD_DATA_PINS_NUMBER					8
+#endif
+
+/* E is the last pin of "arrayofLCDPinConfig" */
+#define LCD_PINS_NUMBER							(LCD_E_PIN + 1)
+
+#if (LCD_DATA_PINS_NUMBER > GPIO_BUS_MAX_WIDTH)
+#error "INVALID GPIO_BUS_MAX_WIDTH is selected :(\nThe LCD's data bus needs it to be at least LCD_DATA_PINS_NUMBER"
+#endif
+
+/* The waits of the initialization in scheduler's ticks */
+#define LCD_POWER_ON_TICKS						SCHED_MS_TO_TICKS(30)
+#define LCD_FUNCTION_SET_TICKS					SCHED_MS_TO_TICKS(5)
+#define LCD_CLEAR_DISPLAY_TICKS					SCHED_MS_TO_TICKS(2)
+
+/* Used inside the coroutines only: runs all the stages of LCD_writeCommandSM/LCD_writeDataSM, one stage
+ * at each call of the coroutine */
+#define LCD_CO_WRITE_COMMAND(Add_pstrCo, Command)	for(writeStages = LCD_WRITE_STAGES; writeStages > 0; writeStages--){\
+														LCD_writeCommandSM(Command); SCHED_CO_YIELD(Add_pstrCo); }
+#define LCD_CO_WRITE_DATA(Add_pstrCo, Data)			for(writeStages = LCD_WRITE_STAGES; writeStages > 0; writeStages--){\
+														LCD_writeDataSM(Data); SCHED_CO_YIELD(Add_pstrCo); }
+
 
 
 /************************************************************************************/
@@ -87,7 +129,9 @@ typedef struct{
 enum{
 	stateOff,
 	stateInitialization,
-	stateOperational
+	stateOperational,
+	/* The pins in "arrayofLCDPinConfig" were refused by the GPIO driver, the LCD takes no requests */
+	stateError
 };
 
 /* The possible states for this driver,
@@ -131,6 +175,21 @@ process_t writeNumProc;
 
 process_t sendCommandProc;
 
+/* The states of the initialization and writing coroutines */
+static SCHED_strCoroutine_t initCo;
+static SCHED_strCoroutine_t writeCo;
+
+/* Remaining stages of the running bus write, and the index of the character being written, the coroutines
+ * lose their local variables at each return so they are kept here */
+static uint8_t writeStages;
+static uint8_t writeIndex;
+
+/* The LCD's pins, validated once by the initialization */
+static GPIO_strPinHandle_t LCDPinHandles [LCD_PINS_NUMBER];
+
+/* The data pins as a parallel bus, their ports must not be more than GPIO_BUS_MAX_PORTS */
+static GPIO_strBus_t LCDDataBus;
+
 
 /************************************************************************************/
 /*							Static Functions' Implementation						*/
@@ -150,81 +209,45 @@ static void LCD_writeCommandSM(uint8_t Copy_uint8Command){
 
 	/* Set the value of RS pin as output low as we are sending a command */
 	case 1:
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[RS_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[RS_4BITMODE].LCD_pin_number,\
-				GPIO_PIN_VAL_LOW);
+		GPIO_vClearPin(&LCDPinHandles[LCD_RS_PIN]);
 		break;
 		/* Set the value of R/w pin as output low as we are writing */
 	case 2:
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[RW_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[RW_4BITMODE].LCD_pin_number,\
-				GPIO_PIN_VAL_LOW);
+		GPIO_vClearPin(&LCDPinHandles[LCD_RW_PIN]);
 		break;
 		/* Set the value of the E pin to be output low to make pulse on it later once we
 		 * put the data on the data pins */
 	case 3:
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[E_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[E_4BITMODE].LCD_pin_number,\
-				GPIO_PIN_VAL_LOW);
+		GPIO_vClearPin(&LCDPinHandles[LCD_E_PIN]);
 		break;
 
 #if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE)
 
 		/* Putting the upper 4-bits data on the data pins of the LCD */
 	case 4:
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[D7_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[D7_4BITMODE].LCD_pin_number,\
-				( ( Copy_uint8Command & (1<<D7) ) >> D7 ));
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[D6_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[D6_4BITMODE].LCD_pin_number,\
-				( ( Copy_uint8Command & (1<<D6) ) >> D6 ));
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[D5_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[D5_4BITMODE].LCD_pin_number,\
-				( ( Copy_uint8Command & (1<<D5) ) >> D5 ));
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[D4_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[D4_4BITMODE].LCD_pin_number,\
-				( ( Copy_uint8Command & (1<<D4) ) >> D4 ));
+		GPIO_vWriteBus(&LCDDataBus, Copy_uint8Command >> D4);
 		break;
 		/* Send a pulse to the E pin to send the data to the LCD */
 		/* Set the value of the E pin to be output high */
 	case 5:
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[E_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[E_4BITMODE].LCD_pin_number,\
-				GPIO_PIN_VAL_HIGH);
+		GPIO_vSetPin(&LCDPinHandles[LCD_E_PIN]);
 		break;
 		/* Set the value of the E pin to be output low */
 	case 6:
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[E_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[E_4BITMODE].LCD_pin_number,\
-				GPIO_PIN_VAL_LOW);
+		GPIO_vClearPin(&LCDPinHandles[LCD_E_PIN]);
 		break;
 		/* Putting the lower 4-bits data on the data pins of the LCD */
 	case 7:
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[D7_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[D7_4BITMODE].LCD_pin_number,\
-				( ( Copy_uint8Command & (1<<D3) ) >> D3 ));
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[D6_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[D6_4BITMODE].LCD_pin_number,\
-				( ( Copy_uint8Command & (1<<D2) ) >> D2 ));
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[D5_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[D5_4BITMODE].LCD_pin_number,\
-				( ( Copy_uint8Command & (1<<D1) ) >> D1 ));
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[D4_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[D4_4BITMODE].LCD_pin_number,\
-				( ( Copy_uint8Command & (1<<D0) ) >> D0 ));
+		GPIO_vWriteBus(&LCDDataBus, Copy_uint8Command);
 		break;
 		/* Send a pulse to the E pin to send the data to the LCD */
 		/* Set the value of the E pin to be output high */
 	case 8:
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[E_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[E_4BITMODE].LCD_pin_number,\
-				GPIO_PIN_VAL_HIGH);
+		GPIO_vSetPin(&LCDPinHandles[LCD_E_PIN]);
 		break;
 		/* Set the value of the E pin to be output low */
 	case 9:
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[E_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[E_4BITMODE].LCD_pin_number,\
-				GPIO_PIN_VAL_LOW);
+		GPIO_vClearPin(&LCDPinHandles[LCD_E_PIN]);
 
 		entryCounter = 0;
 		break;
@@ -234,43 +257,16 @@ static void LCD_writeCommandSM(uint8_t Copy_uint8Command){
 
 		/* Putting the data on the data pins of the LCD */
 	case 4:
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[D7].LCD_port_number,\
-				arrayofLCDPinConfig[D7].LCD_pin_number,\
-				( ( Copy_uint8Command & (1<<D7) ) >> D7 ));
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[D6].LCD_port_number,\
-				arrayofLCDPinConfig[D6].LCD_pin_number,\
-				( ( Copy_uint8Command & (1<<D6) ) >> D6 ));
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[D5].LCD_port_number,\
-				arrayofLCDPinConfig[D5].LCD_pin_number,\
-				( ( Copy_uint8Command & (1<<D5) ) >> D5 ));
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[D4].LCD_port_number,\
-				arrayofLCDPinConfig[D4].LCD_pin_number,\
-				( ( Copy_uint8Command & (1<<D4) ) >> D4 ));
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[D3].LCD_port_number,\
-				arrayofLCDPinConfig[D3].LCD_pin_number,\
-				( ( Copy_uint8Command & (1<<D3) ) >> D3 ));
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[D2].LCD_port_number,\
-				arrayofLCDPinConfig[D2].LCD_pin_number,\
-				( ( Copy_uint8Command & (1<<D2) ) >> D2 ));
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[D1].LCD_port_number,\
-				arrayofLCDPinConfig[D1].LCD_pin_number,\
-				( ( Copy_uint8Command & (1<<D1) ) >> D1 ));
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[D0].LCD_port_number,\
-				arrayofLCDPinConfig[D0].LCD_pin_number,\
-				( ( Copy_uint8Command & (1<<D0) ) >> D0 ));
+		GPIO_vWriteBus(&LCDDataBus, Copy_uint8Command);
 		break;
 		/* Send a pulse to the E pin to send the data to the LCD */
 		/* Set the value of the E pin to be output high */
 	case 5:
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[E_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[E_4BITMODE].LCD_pin_number,\
-				GPIO_PIN_VAL_HIGH);
+		GPIO_vSetPin(&LCDPinHandles[LCD_E_PIN]);
 		break;
 		/* Set the value of the E pin to be output low */
 	case 6:
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[E_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[E_4BITMODE].LCD_pin_number,\
-				GPIO_PIN_VAL_LOW);
+		GPIO_vClearPin(&LCDPinHandles[LCD_E_PIN]);
 
 		entryCounter = 0;
 		break;
@@ -297,81 +293,45 @@ static void LCD_writeDataSM(uint8_t Copy_uint8Data){
 
 	/* Set the value of RS pin as output high as we are sending data */
 	case 1:
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[RS_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[RS_4BITMODE].LCD_pin_number,\
-				GPIO_PIN_VAL_HIGH);
+		GPIO_vSetPin(&LCDPinHandles[LCD_RS_PIN]);
 		break;
 		/* Set the value of R/w pin as output low as we are writing */
 	case 2:
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[RW_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[RW_4BITMODE].LCD_pin_number,\
-				GPIO_PIN_VAL_LOW);
+		GPIO_vClearPin(&LCDPinHandles[LCD_RW_PIN]);
 		break;
 		/* Set the value of the E pin to be output low to make pulse on it later once we
 		 * put the data on the data pins */
 	case 3:
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[E_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[E_4BITMODE].LCD_pin_number,\
-				GPIO_PIN_VAL_LOW);
+		GPIO_vClearPin(&LCDPinHandles[LCD_E_PIN]);
 		break;
 
 #if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE)
 
 		/* Putting the upper 4-bits data on the data pins of the LCD */
 	case 4:
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[D7_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[D7_4BITMODE].LCD_pin_number,\
-				( ( Copy_uint8Data & (1<<D7) ) >> D7 ));
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[D6_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[D6_4BITMODE].LCD_pin_number,\
-				( ( Copy_uint8Data & (1<<D6) ) >> D6 ));
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[D5_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[D5_4BITMODE].LCD_pin_number,\
-				( ( Copy_uint8Data & (1<<D5) ) >> D5 ));
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[D4_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[D4_4BITMODE].LCD_pin_number,\
-				( ( Copy_uint8Data & (1<<D4) ) >> D4 ));
+		GPIO_vWriteBus(&LCDDataBus, Copy_uint8Data >> D4);
 		break;
 		/* Send a pulse to the E pin to send the data to the LCD */
 		/* Set the value of the E pin to be output high */
 	case 5:
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[E_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[E_4BITMODE].LCD_pin_number,\
-				GPIO_PIN_VAL_HIGH);
+		GPIO_vSetPin(&LCDPinHandles[LCD_E_PIN]);
 		break;
 		/* Set the value of the E pin to be output low */
 	case 6:
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[E_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[E_4BITMODE].LCD_pin_number,\
-				GPIO_PIN_VAL_LOW);
+		GPIO_vClearPin(&LCDPinHandles[LCD_E_PIN]);
 		break;
 		/* Putting the lower 4-bits data on the data pins of the LCD */
 	case 7:
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[D7_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[D7_4BITMODE].LCD_pin_number,\
-				( ( Copy_uint8Data & (1<<D3) ) >> D3 ));
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[D6_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[D6_4BITMODE].LCD_pin_number,\
-				( ( Copy_uint8Data & (1<<D2) ) >> D2 ));
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[D5_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[D5_4BITMODE].LCD_pin_number,\
-				( ( Copy_uint8Data & (1<<D1) ) >> D1 ));
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[D4_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[D4_4BITMODE].LCD_pin_number,\
-				( ( Copy_uint8Data & (1<<D0) ) >> D0 ));
+		GPIO_vWriteBus(&LCDDataBus, Copy_uint8Data);
 		break;
 		/* Send a pulse to the E pin to send the data to the LCD */
 		/* Set the value of the E pin to be output high */
 	case 8:
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[E_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[E_4BITMODE].LCD_pin_number,\
-				GPIO_PIN_VAL_HIGH);
+		GPIO_vSetPin(&LCDPinHandles[LCD_E_PIN]);
 		break;
 		/* Set the value of the E pin to be output low */
 	case 9:
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[E_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[E_4BITMODE].LCD_pin_number,\
-				GPIO_PIN_VAL_LOW);
+		GPIO_vClearPin(&LCDPinHandles[LCD_E_PIN]);
 
 		entryCounter = 0;
 		break;
@@ -381,43 +341,16 @@ static void LCD_writeDataSM(uint8_t Copy_uint8Data){
 
 		/* Putting the data on the data pins of the LCD */
 	case 4:
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[D7].LCD_port_number,\
-				arrayofLCDPinConfig[D7].LCD_pin_number,\
-				( ( Copy_uint8Data & (1<<D7) ) >> D7 ));
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[D6].LCD_port_number,\
-				arrayofLCDPinConfig[D6].LCD_pin_number,\
-				( ( Copy_uint8Data & (1<<D6) ) >> D6 ));
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[D5].LCD_port_number,\
-				arrayofLCDPinConfig[D5].LCD_pin_number,\
-				( ( Copy_uint8Data & (1<<D5) ) >> D5 ));
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[D4].LCD_port_number,\
-				arrayofLCDPinConfig[D4].LCD_pin_number,\
-				( ( Copy_uint8Data & (1<<D4) ) >> D4 ));
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[D3].LCD_port_number,\
-				arrayofLCDPinConfig[D3].LCD_pin_number,\
-				( ( Copy_uint8Data & (1<<D3) ) >> D3 ));
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[D2].LCD_port_number,\
-				arrayofLCDPinConfig[D2].LCD_pin_number,\
-				( ( Copy_uint8Data & (1<<D2) ) >> D2 ));
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[D1].LCD_port_number,\
-				arrayofLCDPinConfig[D1].LCD_pin_number,\
-				( ( Copy_uint8Data & (1<<D1) ) >> D1 ));
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[D0].LCD_port_number,\
-				arrayofLCDPinConfig[D0].LCD_pin_number,\
-				( ( Copy_uint8Data & (1<<D0) ) >> D0 ));
+		GPIO_vWriteBus(&LCDDataBus, Copy_uint8Data);
 		break;
 		/* Send a pulse to the E pin to send the data to the LCD */
 		/* Set the value of the E pin to be output high */
 	case 5:
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[E_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[E_4BITMODE].LCD_pin_number,\
-				GPIO_PIN_VAL_HIGH);
+		GPIO_vSetPin(&LCDPinHandles[LCD_E_PIN]);
 		break;
 		/* Set the value of the E pin to be output low */
 	case 6:
-		GPIO_enuSetPinVal(arrayofLCDPinConfig[E_4BITMODE].LCD_port_number,\
-				arrayofLCDPinConfig[E_4BITMODE].LCD_pin_number,\
-				GPIO_PIN_VAL_LOW);
+		GPIO_vClearPin(&LCDPinHandles[LCD_E_PIN]);
 
 		entryCounter = 0;
 		break;
@@ -432,340 +365,140 @@ static void LCD_writeDataSM(uint8_t Copy_uint8Data){
 
 
 /**
- *@brief : Process that initializes the LCD.
+ *@brief : Process that initializes the LCD, a coroutine that sleeps in between the commands.
  *@param : void.
  *@return: void.
  */
-static void LCD_initProcSM(void){
-
-	static uint8_t entryCounter = 0;
-
-#if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE)
-	static uint8_t writeCommandSM_remainingStages = REMAINING_STAGES_4_BIT_MODE_CASE;
-
-#elif (LCD_DATA_BITS_MODE == LCD_EIGHT_BITS_MODE)
-	static uint8_t writeCommandSM_remainingStages = REMAINING_STAGES_8_BIT_MODE_CASE;
-
-#endif  /* #if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE) */
-
-	if(entryCounter == 0){
-		entryCounter++;
-	}
+static void LCD_initProc(void){
 
 	uint8_t LOC_uint8counter;
-	GPIO_strPinConfig_t LOC_LCDPinConfig;
-
+	/* The first error of the GPIO driver while configuring the pins */
+	GPIO_enuErrorStatus_t LOC_enuGPIOStatus = GPIO_enuOk;
+	GPIO_enuErrorStatus_t LOC_enuPinStatus;
+	/* The LCD's pins are configured together once all of them are prepared */
+	GPIO_strPinConfig_t LOC_arrLCDPinsConfig[LCD_PINS_NUMBER];
+	GPIO_strBusPin_t LOC_arrDataBusPins[LCD_DATA_PINS_NUMBER];
 
-	switch(entryCounter){
+	SCHED_CO_BEGIN(&initCo);
 
+	/* Setting the LCD's pins as output high pins */
 #if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE)
-
-	/* Setting the LCD's pins as output low */
-	case 1:
-
-		/* Setting the pins as output low pins */
-		for(LOC_uint8counter = D4_4BITMODE; LOC_uint8counter <= E_4BITMODE; LOC_uint8counter++){
-			/* First enable the GPIOx peripheral to which the current LED is connected */
-			switch (arrayofLCDPinConfig[LOC_uint8counter].LCD_port_number){
-			case GPIO_PORTA:
-				RCC_enuEnableAHB1Peripheral(AHB1_GPIOA);
-				break;
-			case GPIO_PORTB:
-				RCC_enuEnableAHB1Peripheral(AHB1_GPIOB);
-				break;
-			case GPIO_PORTC:
-				RCC_enuEnableAHB1Peripheral(AHB1_GPIOC);
-				break;
-			case GPIO_PORTD:
-				RCC_enuEnableAHB1Peripheral(AHB1_GPIOD);
-				break;
-			case GPIO_PORTE:
-				RCC_enuEnableAHB1Peripheral(AHB1_GPIOE);
-				break;
-			case GPIO_PORTH:
-				RCC_enuEnableAHB1Peripheral(AHB1_GPIOH);
-				break;
-			default:
-				/* The code won't reach here as We already validated the input LED's PORT */
-				break;
-			}
-
-			LOC_LCDPinConfig.GPIO_port = arrayofLCDPinConfig[LOC_uint8counter].LCD_port_number;
-			LOC_LCDPinConfig.GPIO_pin = arrayofLCDPinConfig[LOC_uint8counter].LCD_pin_number;
-			LOC_LCDPinConfig.GPIO_speed = GPIO_SPEED_HIGH;
-			LOC_LCDPinConfig.GPIO_mode = GPIO_MODE_OUTPUT_PP;
-
-			/* Passing the configurations assigned in "LOC_LEDconfig" to the GPIO initialize function
-			 * to initialize the pin */
-			GPIO_enuInitPin(&LOC_LCDPinConfig);
-
-			GPIO_enuSetPinVal(arrayofLCDPinConfig[LOC_uint8counter].LCD_port_number,\
-					arrayofLCDPinConfig[LOC_uint8counter].LCD_pin_number,\
-					GPIO_PIN_VAL_HIGH);
+	for(LOC_uint8counter = D4_4BITMODE; LOC_uint8counter <= E_4BITMODE; LOC_uint8counter++){
+#elif (LCD_DATA_BITS_MODE == LCD_EIGHT_BITS_MODE)
+	for(LOC_uint8counter = D0; LOC_uint8counter <= E; LOC_uint8counter++){
+#endif
+		/* First enable the GPIOx peripheral to which the current LED is connected */
+		switch (arrayofLCDPinConfig[LOC_uint8counter].LCD_port_number){
+		case GPIO_PORTA:
+			RCC_enuEnableAHB1Peripheral(AHB1_GPIOA);
+			break;
+		case GPIO_PORTB:
+			RCC_enuEnableAHB1Peripheral(AHB1_GPIOB);
+			break;
+		case GPIO_PORTC:
+			RCC_enuEnableAHB1Peripheral(AHB1_GPIOC);
+			break;
+		case GPIO_PORTD:
+			RCC_enuEnableAHB1Peripheral(AHB1_GPIOD);
+			break;
+		case GPIO_PORTE:
+			RCC_enuEnableAHB1Peripheral(AHB1_GPIOE);
+			break;
+		case GPIO_PORTH:
+			RCC_enuEnableAHB1Peripheral(AHB1_GPIOH);
+			break;
+		default:
+			/* The code won't reach here as We already validated the input LED's PORT */
+			break;
 		}
 
-		entryCounter++;
-		break;
-	case 2:
-	case 3:
-	case 4:
-	case 5:
-	case 6:
-	case 7:
-	case 8:
-	case 9:
-	case 10:
-	case 11:
-	case 12:
-	case 13:
-	case 14:
-	case 15:
-	case 16:
-	case 17:
-	case 18:
-	case 19:
-	case 20:
-	case 21:
-	case 22:
-	case 23:
-	case 24:
-	case 25:
-	case 26:
-	case 27:
-	case 28:
-	case 29:
-	case 30:
-		entryCounter++;
-		break;
-		/* When coming here again, 30 milliseconds will have been passed (Power on), write command */
-	case 31:
-
-		if (writeCommandSM_remainingStages > 0){
-			LCD_writeCommandSM(LCD_TWO_LINES_FOUR_BITS_MODE_INIT1);
-			writeCommandSM_remainingStages--;
-		}
-		else{
-			writeCommandSM_remainingStages = REMAINING_STAGES_4_BIT_MODE_CASE;
-			entryCounter += 5;
-		}
-		break;
-		/* When coming here again 5 milliseconds will have been passed, write command */
-	case 36:
+		LOC_arrLCDPinsConfig[LOC_uint8counter].GPIO_port = arrayofLCDPinConfig[LOC_uint8counter].LCD_port_number;
+		LOC_arrLCDPinsConfig[LOC_uint8counter].GPIO_pin = arrayofLCDPinConfig[LOC_uint8counter].LCD_pin_number;
+		LOC_arrLCDPinsConfig[LOC_uint8counter].GPIO_speed = GPIO_SPEED_HIGH;
+		LOC_arrLCDPinsConfig[LOC_uint8counter].GPIO_mode = GPIO_MODE_OUTPUT_PP;
 
-		if (writeCommandSM_remainingStages > 0){
-			LCD_writeCommandSM(LCD_TWO_LINES_FOUR_BITS_MODE_INIT2);
-			writeCommandSM_remainingStages--;
+		LOC_enuPinStatus = GPIO_enuInitPinHandle(&LCDPinHandles[LOC_uint8counter],\
+				arrayofLCDPinConfig[LOC_uint8counter].LCD_port_number, arrayofLCDPinConfig[LOC_uint8counter].LCD_pin_number);
+		if(LOC_enuPinStatus == GPIO_enuOk){
+			/* The pin is still an input, it drives high as soon as it becomes an output */
+			GPIO_vSetPin(&LCDPinHandles[LOC_uint8counter]);
 		}
-		else{
-			writeCommandSM_remainingStages = REMAINING_STAGES_4_BIT_MODE_CASE;
-			entryCounter++;
-		}
-		break;
-		/* Function set stage */
-	case 37:
-		/* use 2-lines LCD + 4-bits Data Mode + 5x7 dot display Mode */
-
-		if (writeCommandSM_remainingStages > 0){
-			LCD_writeCommandSM(LCD_FourBitMode_2LineDisplay_5x7);
-			writeCommandSM_remainingStages--;
+		else if(LOC_enuGPIOStatus == GPIO_enuOk){
+			LOC_enuGPIOStatus = LOC_enuPinStatus;
 		}
 		else{
-			writeCommandSM_remainingStages = REMAINING_STAGES_4_BIT_MODE_CASE;
-			entryCounter++;
+			/* Do Nothing */
 		}
-		break;
-		/* Display control stage */
-	case 38:
-		/* Turn the display ON, turn the cursor ON, and turn the blinking on */
+	}
 
-		if (writeCommandSM_remainingStages > 0){
-			LCD_writeCommandSM(LCD_DisplayON_CursorON_BlinkON);
-			writeCommandSM_remainingStages--;
-		}
-		else{
-			writeCommandSM_remainingStages = REMAINING_STAGES_4_BIT_MODE_CASE;
-			entryCounter++;
-		}
-		break;
-		/* Clear display stage */
-	case 39:
+	/* Make all the LCD's pins outputs together, each GPIO register is written once. Nothing is written
+	 * if any of the pins is invalid */
+	if(LOC_enuGPIOStatus == GPIO_enuOk){
+		LOC_enuGPIOStatus = GPIO_enuInitPins(LOC_arrLCDPinsConfig, LCD_PINS_NUMBER);
+	}
+	else{
+		/* Do Nothing */
+	}
 
-		if (writeCommandSM_remainingStages > 0){
-			LCD_writeCommandSM(LCD_ClearDisplay);
-			writeCommandSM_remainingStages--;
-		}
-		else{
-			writeCommandSM_remainingStages = REMAINING_STAGES_4_BIT_MODE_CASE;
-			entryCounter += 2;
-		}
-		break;
-		/* When coming here again 2 milliseconds will have been passed, enter Entry mode set stage */
-	case 41:
+	/* Build the tables of the data bus, the data pins come first in "arrayofLCDPinConfig" */
+	for(LOC_uint8counter = 0; LOC_uint8counter < LCD_DATA_PINS_NUMBER; LOC_uint8counter++){
+		LOC_arrDataBusPins[LOC_uint8counter].GPIO_port = arrayofLCDPinConfig[LCD_FIRST_DATA_PIN + LOC_uint8counter].LCD_port_number;
+		LOC_arrDataBusPins[LOC_uint8counter].GPIO_pin = arrayofLCDPinConfig[LCD_FIRST_DATA_PIN + LOC_uint8counter].LCD_pin_number;
+	}
+	if(LOC_enuGPIOStatus == GPIO_enuOk){
+		LOC_enuGPIOStatus = GPIO_enuInitBus(&LCDDataBus, LOC_arrDataBusPins, LCD_DATA_PINS_NUMBER);
+	}
+	else{
+		/* Do Nothing */
+	}
 
-		if (writeCommandSM_remainingStages > 0){
-			LCD_writeCommandSM(LCD_EntryMode_CursorIncrement_ShiftOFF);
-			writeCommandSM_remainingStages--;
-		}
-		else{
-			writeCommandSM_remainingStages = REMAINING_STAGES_4_BIT_MODE_CASE;
-			entryCounter++;
-		}
-		break;
-		/* We reach the end of initialization, change to readyForRequest, enter the stateOperational
-		 * state, and call the passed callback function */
-	case 42:
-		entryCounter = 0;
+	/* The LCD can't be driven with these pins, stop in the error state and tell the user that the
+	 * initialization has ended, LCD_enuGetState tells it failed */
+	if(LOC_enuGPIOStatus != GPIO_enuOk){
 		userReq.state = readyForRequest;
-		lcdState = stateOperational;
+		lcdState = stateError;
+		SCHED_CO_RESET(&initCo);
 		initProc.callBack();
-		break;
-
-#elif (LCD_DATA_BITS_MODE == LCD_EIGHT_BITS_MODE)
+		return;
+	}
+	else{
+		/* Do Nothing */
+	}
 
-		/* Setting the LCD's pins as output low */
-	case 1:
+	/* Power on */
+	SCHED_CO_SLEEP(&initCo, LCD_POWER_ON_TICKS);
 
-		/* Setting the pins as an output low pins */
-		for(LOC_uint8counter = D0; LOC_uint8counter <= E; LOC_uint8counter++){
-			/* First enable the GPIOx peripheral to which the current LED is connected */
-			switch (arrayofLCDPinConfig[LOC_uint8counter].LCD_port_number){
-			case GPIO_PORTA:
-				RCC_enuEnableAHB1Peripheral(AHB1_GPIOA);
-				break;
-			case GPIO_PORTB:
-				RCC_enuEnableAHB1Peripheral(AHB1_GPIOB);
-				break;
-			case GPIO_PORTC:
-				RCC_enuEnableAHB1Peripheral(AHB1_GPIOC);
-				break;
-			case GPIO_PORTD:
-				RCC_enuEnableAHB1Peripheral(AHB1_GPIOD);
-				break;
-			case GPIO_PORTE:
-				RCC_enuEnableAHB1Peripheral(AHB1_GPIOE);
-				break;
-			case GPIO_PORTH:
-				RCC_enuEnableAHB1Peripheral(AHB1_GPIOH);
-				break;
-			default:
-				/* The code won't reach here as We already validated the input LED's PORT */
-				break;
-			}
+#if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE)
+	LCD_CO_WRITE_COMMAND(&initCo, LCD_TWO_LINES_FOUR_BITS_MODE_INIT1);
+	SCHED_CO_SLEEP(&initCo, LCD_FUNCTION_SET_TICKS);
+	LCD_CO_WRITE_COMMAND(&initCo, LCD_TWO_LINES_FOUR_BITS_MODE_INIT2);
 
-			LOC_LCDPinConfig.GPIO_port = arrayofLCDPinConfig[LOC_uint8counter].LCD_port_number;
-			LOC_LCDPinConfig.GPIO_pin = arrayofLCDPinConfig[LOC_uint8counter].LCD_pin_number;
-			LOC_LCDPinConfig.GPIO_speed = GPIO_SPEED_HIGH;
-			LOC_LCDPinConfig.GPIO_mode = GPIO_MODE_OUTPUT_PP;
+	/* Function set stage: use 2-lines LCD + 4-bits Data Mode + 5x7 dot display Mode */
+	LCD_CO_WRITE_COMMAND(&initCo, LCD_FourBitMode_2LineDisplay_5x7);
 
-			/* Passing the configurations assigned in "LOC_LEDconfig" to the GPIO initialize function
-			 * to initialize the pin */
-			GPIO_enuInitPin(&LOC_LCDPinConfig);
+#elif (LCD_DATA_BITS_MODE == LCD_EIGHT_BITS_MODE)
+	/* Function set stage: use 2-lines LCD + 8-bits Data Mode + 5x7 dot display Mode */
+	LCD_CO_WRITE_COMMAND(&initCo, LCD_EightBitMode_2LineDisplay_5x7);
 
-			GPIO_enuSetPinVal(arrayofLCDPinConfig[LOC_uint8counter].LCD_port_number,\
-					arrayofLCDPinConfig[LOC_uint8counter].LCD_pin_number,\
-					GPIO_PIN_VAL_HIGH);
-		}
+#endif  /* #if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE) */
 
-		entryCounter++;
-		break;
-	case 2:
-	case 3:
-	case 4:
-	case 5:
-	case 6:
-	case 7:
-	case 8:
-	case 9:
-	case 10:
-	case 11:
-	case 12:
-	case 13:
-	case 14:
-	case 15:
-	case 16:
-	case 17:
-	case 18:
-	case 19:
-	case 20:
-	case 21:
-	case 22:
-	case 23:
-	case 24:
-	case 25:
-	case 26:
-	case 27:
-	case 28:
-	case 29:
-	case 30:
-		entryCounter++;
-		break;
-		/* When coming here again 30 milliseconds will have been passed (Power on), enter
-		 * Function set stage */
-	case 31:
-		/* use 2-lines LCD + 8-bits Data Mode + 5x7 dot display Mode */
-
-		if (writeCommandSM_remainingStages > 0){
-			LCD_writeCommandSM(LCD_EightBitMode_2LineDisplay_5x7);
-			writeCommandSM_remainingStages--;
-		}
-		else{
-			writeCommandSM_remainingStages = REMAINING_STAGES_8_BIT_MODE_CASE;
-			entryCounter++;
-		}
-		break;
-		/* Display control stage */
-	case 32:
-		/* Turn the display ON, turn the cursor ON, and turn the blinking on */
+	/* Display control stage: turn the display ON, turn the cursor ON, and turn the blinking on */
+	LCD_CO_WRITE_COMMAND(&initCo, LCD_DisplayON_CursorON_BlinkON);
 
-		if (writeCommandSM_remainingStages > 0){
-			LCD_writeCommandSM(LCD_DisplayON_CursorON_BlinkON);
-			writeCommandSM_remainingStages--;
-		}
-		else{
-			writeCommandSM_remainingStages = REMAINING_STAGES_8_BIT_MODE_CASE;
-			entryCounter++;
-		}
-		break;
-		/* Clear display stage */
-	case 33:
+	/* Clear display stage */
+	LCD_CO_WRITE_COMMAND(&initCo, LCD_ClearDisplay);
+	SCHED_CO_SLEEP(&initCo, LCD_CLEAR_DISPLAY_TICKS);
 
-		if (writeCommandSM_remainingStages > 0){
-			LCD_writeCommandSM(LCD_ClearDisplay);
-			writeCommandSM_remainingStages--;
-		}
-		else{
-			writeCommandSM_remainingStages = REMAINING_STAGES_8_BIT_MODE_CASE;
-			entryCounter += 2;
-		}
-		break;
-		/* When coming here again 2 milliseconds will have been passed, enter Entry mode set stage */
-	case 35:
+	/* Entry mode set stage */
+	LCD_CO_WRITE_COMMAND(&initCo, LCD_EntryMode_CursorIncrement_ShiftOFF);
 
-		if (writeCommandSM_remainingStages > 0){
-			LCD_writeCommandSM(LCD_EntryMode_CursorIncrement_ShiftOFF);
-			writeCommandSM_remainingStages--;
-		}
-		else{
-			writeCommandSM_remainingStages = REMAINING_STAGES_8_BIT_MODE_CASE;
-			entryCounter += 2;
-		}
-		break;
-		/* We reach the end of initialization, change to readyForRequest, enter the stateOperational
-		 * state, and call the passed callback function */
-	case 36:
-		entryCounter = 0;
-		userReq.state = readyForRequest;
-		lcdState = stateOperational;
-		initProc.callBack();
-		break;
+	/* We reach the end of initialization, change to readyForRequest, enter the stateOperational
+	 * state, and call the passed callback function */
+	userReq.state = readyForRequest;
+	lcdState = stateOperational;
+	initProc.callBack();
 
-#endif  /* #if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE) */
-
-
-	default:
-		/* Do Nothing */
-		break;
-	}
+	SCHED_CO_END(&initCo);
 }
 
 
@@ -775,66 +508,19 @@ static void LCD_initProcSM(void){
  *@return: void.
  */
 static void LCD_writeProc(void){
-	static uint8_t entryCounter = 0;
-
-#if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE)
-	static uint8_t writeDataSM_remainingStages = REMAINING_STAGES_4_BIT_MODE_CASE;
-
-#elif (LCD_DATA_BITS_MODE == LCD_EIGHT_BITS_MODE)
-	static uint8_t writeDataSM_remainingStages = REMAINING_STAGES_8_BIT_MODE_CASE;
-
-#endif  /* #if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE) */
-
-#if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE)
 
-	/* Check if We reached the NULL character or not */
-	if(userReq.string[entryCounter] != '\0'){
+	SCHED_CO_BEGIN(&writeCo);
 
-		/* Check if We finished all stages of the LCD_writeDataSM or not */
-		if(writeDataSM_remainingStages > 0){
-			LCD_writeDataSM(userReq.string[entryCounter]);
-			writeDataSM_remainingStages--;
-		}
-		else{
-			/* We finished the printing of one character */
-			writeDataSM_remainingStages = REMAINING_STAGES_4_BIT_MODE_CASE;
-			entryCounter++;
-		}
+	for(writeIndex = 0; userReq.string[writeIndex] != '\0'; writeIndex++){
+		LCD_CO_WRITE_DATA(&writeCo, userReq.string[writeIndex]);
 	}
-	else{
-		/* We finished the Printing of the Whole string */
-		entryCounter = 0;
-		userReq.type = NULL;
-		userReq.state = readyForRequest;
-		writeProc.callBack();
-	}
-
-#elif (LCD_DATA_BITS_MODE == LCD_EIGHT_BITS_MODE)
 
-	/* Check if We reached the NULL character or not */
-	if(userReq.string[entryCounter] != '\0'){
-
-		/* Check if We finished all stages of the LCD_writeDataSM or not */
-		if(writeDataSM_remainingStages > 0){
-			LCD_writeDataSM(userReq.string[entryCounter]);
-			writeDataSM_remainingStages--;
-		}
-		else{
-			/* We finished the printing of one character */
-			writeDataSM_remainingStages = REMAINING_STAGES_8_BIT_MODE_CASE;
-			entryCounter++;
-		}
-	}
-	else{
-		/* We finished the Printing of the Whole string */
-		entryCounter = 0;
-		userReq.type = NULL;
-		userReq.state = readyForRequest;
-		writeProc.callBack();
-	}
-
-#endif  /* #if (LCD_DATA_BITS_MODE == LCD_FOUR_BITS_MODE) */
+	/* We finished the Printing of the Whole string */
+	userReq.type = NULL;
+	userReq.state = readyForRequest;
+	writeProc.callBack();
 
+	SCHED_CO_END(&writeCo);
 }
 
 
@@ -1421,7 +1107,7 @@ void RUNNABLE_LCD(void){
 	/* Jump to the current LCD's state */
 	switch(lcdState){
 	case stateInitialization:
-		LCD_initProcSM();
+		LCD_initProc();
 		break;
 	case stateOperational:
 		if(userReq.state == busyWithRequest){
@@ -1452,6 +1138,9 @@ void RUNNABLE_LCD(void){
 		break;
 	case stateOff:
 
+		break;
+	case stateError:
+		/* Do Nothing, the pins are wrong */
 		break;
 	default:
 		/* Do Nothing */
@@ -36,6 +36,9 @@
 
 extern LED_strLEDconfig_t arrayofLEDsconfig [NUM_OF_LEDS];
 
+/* The LEDs' pins, validated once by LED_enuInit */
+static GPIO_strPinHandle_t LEDsPinHandles [NUM_OF_LEDS];
+
 /****************************************************************************************/
 /*									APIs Implementation									*/
 /****************************************************************************************/
@@ -60,7 +63,8 @@ LED_enuErrorStatus_t LED_enuInit(void)
 	else
 	{
 		uint8_t LOC_uint8counter;
-		GPIO_strPinConfig_t LOC_LEDconfig;
+		/* The LEDs' pins are configured together once all of them are checked */
+		GPIO_strPinConfig_t LOC_arrLEDsConfig[NUM_OF_LEDS];
 		for(LOC_uint8counter = 0; LOC_uint8counter < NUM_OF_LEDS; LOC_uint8counter++)
 		{
 
@@ -105,21 +109,23 @@ LED_enuErrorStatus_t LED_enuInit(void)
 				/* Now check that the GPIO peripheral is enabled */
 				if (LOC_enuErrorStatus == RCC_enuOk)
 				{
-					/* Till now, everything is OK, We can start configure the pins */
+					/* Till now, everything is OK, We can prepare the pin's configuration */
 
-					LOC_LEDconfig.GPIO_port = arrayofLEDsconfig[LOC_uint8counter].LED_port_number;
-					LOC_LEDconfig.GPIO_pin = arrayofLEDsconfig[LOC_uint8counter].LED_pin_number;
-					LOC_LEDconfig.GPIO_speed = GPIO_SPEED_HIGH;
-					LOC_LEDconfig.GPIO_mode = GPIO_MODE_OUTPUT_PP;
+					LOC_arrLEDsConfig[LOC_uint8counter].GPIO_port = arrayofLEDsconfig[LOC_uint8counter].LED_port_number;
+					LOC_arrLEDsConfig[LOC_uint8counter].GPIO_pin = arrayofLEDsconfig[LOC_uint8counter].LED_pin_number;
+					LOC_arrLEDsConfig[LOC_uint8counter].GPIO_speed = GPIO_SPEED_HIGH;
+					LOC_arrLEDsConfig[LOC_uint8counter].GPIO_mode = GPIO_MODE_OUTPUT_PP;
 
-					/* Passing the configurations assigned in "LOC_LEDconfig" to the GPIO initialize function
-					 * to initialize the pin */
-					LOC_enuErrorStatus = GPIO_enuInitPin(&LOC_LEDconfig);
+					/* Keep a handle of the pin to drive it later without validating it again */
+					LOC_enuErrorStatus = GPIO_enuInitPinHandle(&LEDsPinHandles[LOC_uint8counter],\
+							arrayofLEDsconfig[LOC_uint8counter].LED_port_number,\
+							arrayofLEDsconfig[LOC_uint8counter].LED_pin_number);
 
-					/* Check that the last LED's pin is Initially configured correctly */
+					/* Check that the last LED's pin has a handle */
 					if (LOC_enuErrorStatus == GPIO_enuOk)
 					{
-						/* The last LED's pin is Initially configured correctly, We now can set its initial state */
+						/* The pin is still an input, the initial state set now in its ODR is driven as soon
+						 * as it becomes an output, so the LED never flashes at start up */
 
 						/* Switch on the LED's Active type */
 						switch(arrayofLEDsconfig[LOC_uint8counter].connection_type)
@@ -129,15 +135,11 @@ LED_enuErrorStatus_t LED_enuInit(void)
 							{
 							case LED_enuOFF:
 								/* Setting the configuration after checking that everything is correct and OK */
-								LOC_enuErrorStatus = GPIO_enuSetPinVal(arrayofLEDsconfig[LOC_uint8counter].LED_port_number,\
-										arrayofLEDsconfig[LOC_uint8counter].LED_pin_number,\
-										PIN_VAL_ActiveLow_PowerOFF);
+								GPIO_vWritePin(&LEDsPinHandles[LOC_uint8counter], PIN_VAL_ActiveLow_PowerOFF);
 								break;
 							case LED_enuON:
 								/* Setting the configuration after checking that everything is correct and OK */
-								LOC_enuErrorStatus = GPIO_enuSetPinVal(arrayofLEDsconfig[LOC_uint8counter].LED_port_number,\
-										arrayofLEDsconfig[LOC_uint8counter].LED_pin_number,\
-										PIN_VAL_ActiveLow_PowerON);
+								GPIO_vWritePin(&LEDsPinHandles[LOC_uint8counter], PIN_VAL_ActiveLow_PowerON);
 								break;
 							default:
 								/* The code won't reach here as We already validated the input LED's Initial state */
@@ -149,15 +151,11 @@ LED_enuErrorStatus_t LED_enuInit(void)
 							{
 							case LED_enuOFF:
 								/* Setting the configuration after checking that everything is correct and OK */
-								LOC_enuErrorStatus = GPIO_enuSetPinVal(arrayofLEDsconfig[LOC_uint8counter].LED_port_number,\
-										arrayofLEDsconfig[LOC_uint8counter].LED_pin_number,\
-										PIN_VAL_ActiveHigh_PowerOFF);
+								GPIO_vWritePin(&LEDsPinHandles[LOC_uint8counter], PIN_VAL_ActiveHigh_PowerOFF);
 								break;
 							case LED_enuON:
 								/* Setting the configuration after checking that everything is correct and OK */
-								LOC_enuErrorStatus = GPIO_enuSetPinVal(arrayofLEDsconfig[LOC_uint8counter].LED_port_number,\
-										arrayofLEDsconfig[LOC_uint8counter].LED_pin_number,\
-										PIN_VAL_ActiveHigh_PowerON);
+								GPIO_vWritePin(&LEDsPinHandles[LOC_uint8counter], PIN_VAL_ActiveHigh_PowerON);
 								break;
 							default:
 								/* The code won't reach here as We already validated the input LED's Initial type */
@@ -183,7 +181,7 @@ LED_enuErrorStatus_t LED_enuInit(void)
 					}
 					else
 					{
-						/* The last LED's pin could not be Initially configured correctly for some reasons */
+						/* The last LED's pin could not get a handle for some reasons */
 						LOC_enuErrorStatus = LED_enuNotOk;
 						/* Stop looping on the LEDs, return error */
 						break;
@@ -205,6 +203,23 @@ LED_enuErrorStatus_t LED_enuInit(void)
 				break;
 			}
 		}
+
+		/* All the LEDs are OK, configure their pins as outputs, each GPIO register is written once */
+		if (LOC_enuErrorStatus == LED_enuOk)
+		{
+			if (GPIO_enuInitPins(LOC_arrLEDsConfig, NUM_OF_LEDS) != GPIO_enuOk)
+			{
+				LOC_enuErrorStatus = LED_enuNotOk;
+			}
+			else
+			{
+				/* Do Nothing */
+			}
+		}
+		else
+		{
+			/* Do Nothing */
+		}
 	}
 
 
@@ -230,14 +245,10 @@ LED_enuErrorStatus_t LED_enuPowerON(uint8_t copy_LEDname)
 		switch(arrayofLEDsconfig[copy_LEDname].connection_type)
 		{
 		case LED_enuActiveLow:
-			LOC_enuErrorStatus = GPIO_enuSetPinVal(arrayofLEDsconfig[copy_LEDname].LED_port_number,\
-					arrayofLEDsconfig[copy_LEDname].LED_pin_number,\
-					PIN_VAL_ActiveLow_PowerON);
+			GPIO_vWritePin(&LEDsPinHandles[copy_LEDname], PIN_VAL_ActiveLow_PowerON);
 			break;
 		case LED_enuActiveHigh:
-			LOC_enuErrorStatus = GPIO_enuSetPinVal(arrayofLEDsconfig[copy_LEDname].LED_port_number,\
-					arrayofLEDsconfig[copy_LEDname].LED_pin_number,\
-					PIN_VAL_ActiveHigh_PowerON);
+			GPIO_vWritePin(&LEDsPinHandles[copy_LEDname], PIN_VAL_ActiveHigh_PowerON);
 			break;
 		default:
 			/* The code won't reach here as We already validated the input LED's Connection type */
@@ -272,14 +283,10 @@ LED_enuErrorStatus_t LED_enuPowerOFF(uint8_t copy_LEDname)
 		switch(arrayofLEDsconfig[copy_LEDname].connection_type)
 		{
 		case LED_enuActiveLow:
-			LOC_enuErrorStatus = GPIO_enuSetPinVal(arrayofLEDsconfig[copy_LEDname].LED_port_number,\
-					arrayofLEDsconfig[copy_LEDname].LED_pin_number,\
-					PIN_VAL_ActiveLow_PowerOFF);
+			GPIO_vWritePin(&LEDsPinHandles[copy_LEDname], PIN_VAL_ActiveLow_PowerOFF);
 			break;
 		case LED_enuActiveHigh:
-			LOC_enuErrorStatus = GPIO_enuSetPinVal(arrayofLEDsconfig[copy_LEDname].LED_port_number,\
-					arrayofLEDsconfig[copy_LEDname].LED_pin_number,\
-					PIN_VAL_ActiveHigh_PowerOFF);
+			GPIO_vWritePin(&LEDsPinHandles[copy_LEDname], PIN_VAL_ActiveHigh_PowerOFF);
 			break;
 		default:
 			/* The code won't reach here as We already validated the input LED's Connection type */
@@ -294,3 +301,31 @@ LED_enuErrorStatus_t LED_enuPowerOFF(uint8_t copy_LEDname)
 
 	return LOC_enuErrorStatus;
 }
+
+
+/**
+ *@brief : Function to toggle the entered LED.
+ *@param : Name of the LED you want to toggle.
+ *@return: Error Status.
+ */
+LED_enuErrorStatus_t LED_enuToggle(uint8_t copy_LEDname)
+{
+	/* A local variable to assign the error state inside it and use only one return in the whole function
+	 * through returning the value of this local variable.
+	 * Initially we assume that everything is OK, if not its value will be changed according to a definite error type */
+	LED_enuErrorStatus_t LOC_enuErrorStatus = LED_enuOk;
+
+	/* Check on the input LED name if it is in the LEDs list or not */
+	if(copy_LEDname < NUM_OF_LEDS)
+	{
+		/* Inverting the pin inverts the LED whatever its connection type is */
+		GPIO_vTogglePin(&LEDsPinHandles[copy_LEDname]);
+	}
+	else
+	{
+		/* The user didn't enter on of the listed LEDs */
+		LOC_enuErrorStatus = LED_enuNotOk;
+	}
+
+	return LOC_enuErrorStatus;
+}
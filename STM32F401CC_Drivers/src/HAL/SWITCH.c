@@ -35,6 +35,9 @@
 
 extern SWITCH_strSwitchConfig_t arrayofSwitchesConfig [NUM_OF_SWITCHES];
 
+/* The switches' pins, validated once by SWITCH_enuInit */
+static GPIO_strPinHandle_t switchesPinHandles [NUM_OF_SWITCHES];
+
 /****************************************************************************************/
 /*									APIs Implementation									*/
 /****************************************************************************************/
@@ -59,7 +62,9 @@ SWITCH_enuErrorStatus_t SWITCH_enuInit(void)
 	else
 	{
 		uint8_t LOC_uint8counter;
-		GPIO_strPinConfig_t LOC_SwitchConfig;
+		/* The switches' pins are configured together once all of them are checked */
+		GPIO_strPinConfig_t LOC_arrSwitchesConfig[NUM_OF_SWITCHES];
+		GPIO_strPinConfig_t* LOC_pstrSwitchConfig;
 		for(LOC_uint8counter = 0; LOC_uint8counter < NUM_OF_SWITCHES; LOC_uint8counter++)
 		{
 
@@ -102,11 +107,12 @@ SWITCH_enuErrorStatus_t SWITCH_enuInit(void)
 				/* Now check that the GPIO peripheral is enabled */
 				if (LOC_enuErrorStatus == RCC_enuOk)
 				{
-					/* Till now, everything is OK, We can start configure the pins */
+					/* Till now, everything is OK, We can prepare the pin's configuration */
 
-					LOC_SwitchConfig.GPIO_port = arrayofSwitchesConfig[LOC_uint8counter].SW_port_number;
-					LOC_SwitchConfig.GPIO_pin = arrayofSwitchesConfig[LOC_uint8counter].SW_pin_number;
-					LOC_SwitchConfig.GPIO_speed = GPIO_SPEED_HIGH;
+					LOC_pstrSwitchConfig = &LOC_arrSwitchesConfig[LOC_uint8counter];
+					LOC_pstrSwitchConfig->GPIO_port = arrayofSwitchesConfig[LOC_uint8counter].SW_port_number;
+					LOC_pstrSwitchConfig->GPIO_pin = arrayofSwitchesConfig[LOC_uint8counter].SW_pin_number;
+					LOC_pstrSwitchConfig->GPIO_speed = GPIO_SPEED_HIGH;
 
 					/* Now We will switch (search/loop) on the Switch's connection type,
 					 * to configure the pin with the correct input type */
@@ -114,34 +120,35 @@ SWITCH_enuErrorStatus_t SWITCH_enuInit(void)
 					switch (arrayofSwitchesConfig[LOC_uint8counter].SW_connection_method)
 					{
 					case SWITCH_enuInternalPullUpConnection:
-						LOC_SwitchConfig.GPIO_mode = PIN_Connection_InternalPullUp;
+						LOC_pstrSwitchConfig->GPIO_mode = PIN_Connection_InternalPullUp;
 						break;
 					case SWITCH_enuExternalPullUpConnection:
-						LOC_SwitchConfig.GPIO_mode = PIN_Connection_ExternalPullUp;
+						LOC_pstrSwitchConfig->GPIO_mode = PIN_Connection_ExternalPullUp;
 						break;
 					case SWITCH_enuInternalPullDownConnection:
-						LOC_SwitchConfig.GPIO_mode = PIN_Connection_InternalPullDown;
+						LOC_pstrSwitchConfig->GPIO_mode = PIN_Connection_InternalPullDown;
 						break;
 					case SWITCH_enuExternalPullDownConnection:
-						LOC_SwitchConfig.GPIO_mode = PIN_Connection_ExternalPullDown;
+						LOC_pstrSwitchConfig->GPIO_mode = PIN_Connection_ExternalPullDown;
 						break;
 					default:
 						/* The code won't reach here as We already validated the input Switch's Connection method */
 						break;
 					}
 
-					/* Passing the configurations assigned in "LOC_SwitchConfig" to the GPIO initialize function
-					 * to initialize the pin */
-					LOC_enuErrorStatus = GPIO_enuInitPin(&LOC_SwitchConfig);
+					/* Keep a handle of the pin to read it later without validating it again */
+					LOC_enuErrorStatus = GPIO_enuInitPinHandle(&switchesPinHandles[LOC_uint8counter],\
+							arrayofSwitchesConfig[LOC_uint8counter].SW_port_number,\
+							arrayofSwitchesConfig[LOC_uint8counter].SW_pin_number);
 
-					/* Check that the last Switch's pin is Initially configured correctly */
+					/* Check that the last Switch's pin has a handle */
 					if (LOC_enuErrorStatus == GPIO_enuOk)
 					{
-						/* We managed to initialize this Switch correctly, continue */
+						/* We managed to prepare this Switch correctly, continue */
 					}
 					else
 					{
-						/* The last Switch's pin could not be Initially configured correctly for some reasons */
+						/* The last Switch's pin could not get a handle for some reasons */
 						LOC_enuErrorStatus = SWITCH_enuNotOk;
 						/* Stop looping on the LEDs, return error */
 						break;
@@ -163,6 +170,23 @@ SWITCH_enuErrorStatus_t SWITCH_enuInit(void)
 				break;
 			}
 		}
+
+		/* All the switches are OK, configure their pins as inputs, each GPIO register is written once */
+		if (LOC_enuErrorStatus == SWITCH_enuOk)
+		{
+			if (GPIO_enuInitPins(LOC_arrSwitchesConfig, NUM_OF_SWITCHES) != GPIO_enuOk)
+			{
+				LOC_enuErrorStatus = SWITCH_enuNotOk;
+			}
+			else
+			{
+				/* Do Nothing */
+			}
+		}
+		else
+		{
+			/* Do Nothing */
+		}
 	}
 
 	return LOC_enuErrorStatus;
@@ -195,13 +219,8 @@ SWITCH_enuErrorStatus_t SWITCH_enuGetSwitchState(uint8_t copy_uint8SwitchName, S
 	{
 		/* Seems like the user entered valid parameters, We can Read the switch's pin's state */
 
-		/* Local variable used to be passed to "GPIO_enuGetPinVal" function to assign in it the switch state */
-		uint32_t u32SwitchPinState = 0;
-
-		/* Read the error state when reading the value of the pin which the switch is connected to */
-		LOC_enuErrorStatus = GPIO_enuGetPinVal(arrayofSwitchesConfig[copy_uint8SwitchName].SW_port_number,\
-												arrayofSwitchesConfig[copy_uint8SwitchName].SW_pin_number,\
-												&u32SwitchPinState);
+		/* Read the state of the switch's pin, GPIO_PIN_VAL_LOW or GPIO_PIN_VAL_HIGH, with one load */
+		uint32_t u32SwitchPinState = GPIO_u32ReadPin(&switchesPinHandles[copy_uint8SwitchName]);
 
 		switch(arrayofSwitchesConfig[copy_uint8SwitchName].SW_connection_method)
 		{
@@ -209,14 +228,9 @@ SWITCH_enuErrorStatus_t SWITCH_enuGetSwitchState(uint8_t copy_uint8SwitchName, S
 		 * reflexes the same switch's state */
 		case SWITCH_enuInternalPullUpConnection:
 		case SWITCH_enuExternalPullUpConnection:
-			/* Check if the function "GPIO_enuGetPinVal" works properly and exits after assigning the value of
-			 * the pin in "u32SwitchPinState", and check if the button is pressed or not, and since it is connected
-			 * with pull up resistance, so when it is pressed the value of the button will be LOW, so we will check on
-			 * the LOW state */
-			if ((GPIO_enuGetPinVal(arrayofSwitchesConfig[copy_uint8SwitchName].SW_port_number,\
-									arrayofSwitchesConfig[copy_uint8SwitchName].SW_pin_number,\
-									&u32SwitchPinState) == GPIO_enuOk)\
-					&& (u32SwitchPinState == GPIO_PIN_VAL_LOW))
+			/* Check if the button is pressed or not, and since it is connected with pull up resistance,
+			 * so when it is pressed the value of the button will be LOW, so we will check on the LOW state */
+			if (u32SwitchPinState == GPIO_PIN_VAL_LOW)
 			{
 				*Add_enuSwitchState = SWITCH_enuIS_PRESSED;
 			}
@@ -230,14 +244,9 @@ SWITCH_enuErrorStatus_t SWITCH_enuGetSwitchState(uint8_t copy_uint8SwitchName, S
 			 * reflexes the same switch's state */
 		case SWITCH_enuInternalPullDownConnection:
 		case SWITCH_enuExternalPullDownConnection:
-			/* Check if the function "GPIO_enuGetPinVal" works properly and exits after assigning the value of
-			 * the pin in "u32SwitchPinState", and check if the button is pressed or not, and since it is connected
-			 * with pull down resistance, so when it is pressed the value of the button will be HIGH, so we
-			 * will check on the HIGH state */
-			if ((GPIO_enuGetPinVal(arrayofSwitchesConfig[copy_uint8SwitchName].SW_port_number,\
-									arrayofSwitchesConfig[copy_uint8SwitchName].SW_pin_number,\
-									&u32SwitchPinState) == GPIO_enuOk)\
-					&& (u32SwitchPinState == GPIO_PIN_VAL_HIGH))
+			/* Check if the button is pressed or not, and since it is connected with pull down resistance,
+			 * so when it is pressed the value of the button will be HIGH, so we will check on the HIGH state */
+			if (u32SwitchPinState == GPIO_PIN_VAL_HIGH)
 			{
 				*Add_enuSwitchState = SWITCH_enuIS_PRESSED;
 			}
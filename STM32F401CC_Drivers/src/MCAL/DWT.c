@@ -0,0 +1,303 @@
+/******************************************************************************
+*
+* Module: DWT Driver
+*
+* File Name: DWT.c
+*
+* Description: Driver's APIs' Implementation and typedefs' declaration.
+*
+* Author: Shaher Shah Abdalla Kamal
+*
+* Date: 17-10-2026
+*
+*******************************************************************************/
+
+
+
+/****************************************************************************************/
+/*										Includes										*/
+/****************************************************************************************/
+
+#include <MCAL/DWT.h>
+
+
+
+/****************************************************************************************/
+/*									Macros Declaration									*/
+/****************************************************************************************/
+
+
+/* The base address of the DWT register block */
+#define DWT_BASE_ADDRESS						(0xE0001000UL)
+/* The address of the Debug Exception and Monitor Control Register (DEMCR) */
+#define DEMCR_ADDRESS							(0xE000EDFCUL)
+
+/* DEMCR TRCENA bit set mask, it enables the DWT and ITM units */
+#define DEMCR_TRCENA_SET_MASK					(0x01000000UL)
+/* DWT_CTRL CYCCNTENA bit set mask */
+#define DWT_CTRL_CYCCNTENA_SET_MASK				(0x00000001UL)
+/* DWT_CTRL NOCYCCNT bit set mask, it's read as one if there's no cycle counter */
+#define DWT_CTRL_NOCYCCNT_SET_MASK				(0x02000000UL)
+
+/* The core clock after reset, the HSI */
+#define DWT_RESET_CORE_CLOCK					(16000000UL)
+
+/* Microseconds and nanoseconds in a second */
+#define DWT_US_PER_SECOND						(1000000ULL)
+#define DWT_NS_PER_SECOND						(1000000000ULL)
+
+
+
+/****************************************************************************************/
+/*								User-defined types Declaration							*/
+/****************************************************************************************/
+
+
+typedef struct {
+	volatile uint32_t DWT_CTRL;
+	volatile uint32_t DWT_CYCCNT;
+	volatile uint32_t DWT_CPICNT;
+	volatile uint32_t DWT_EXCCNT;
+	volatile uint32_t DWT_SLEEPCNT;
+	volatile uint32_t DWT_LSUCNT;
+	volatile uint32_t DWT_FOLDCNT;
+	volatile uint32_t DWT_PCSR;
+}DWT_strRegsiters_t;
+
+
+
+/****************************************************************************************/
+/*									Variables's Declaration								*/
+/****************************************************************************************/
+
+
+static DWT_strRegsiters_t* const DWT = (DWT_strRegsiters_t*)(DWT_BASE_ADDRESS);
+
+static volatile uint32_t* const DEMCR = (volatile uint32_t*)(DEMCR_ADDRESS);
+
+/* The core clock in Hz, set by DWT_enuSetCoreClock */
+static uint32_t GLB_u32CoreClock = DWT_RESET_CORE_CLOCK;
+
+
+
+/****************************************************************************************/
+/*								Static Functions' Declaration							*/
+/****************************************************************************************/
+
+
+/**
+ *@brief : Function to start the cycle counter if it isn't counting, without resetting it.
+ *@param : void.
+ *@return: void.
+ */
+static inline void DWT_vStartCycleCounter(void)
+{
+	if (!(DWT->DWT_CTRL & DWT_CTRL_CYCCNTENA_SET_MASK))
+	{
+		*DEMCR |= DEMCR_TRCENA_SET_MASK;
+		DWT->DWT_CTRL |= DWT_CTRL_CYCCNTENA_SET_MASK;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+
+/**
+ *@brief : Function to convert a time to core cycles, rounded up.
+ *@param : The time and the number of its units in a second.
+ *@return: The number of cycles.
+ */
+static inline uint64_t DWT_u64ToCycles(uint32_t Copy_u32Time, uint64_t Copy_u64UnitsPerSecond)
+{
+	return (((uint64_t)Copy_u32Time * GLB_u32CoreClock) + Copy_u64UnitsPerSecond - 1) / Copy_u64UnitsPerSecond;
+}
+
+
+/**
+ *@brief : Function to start a deadline after the given number of cycles.
+ *@param : The deadline and the number of cycles.
+ *@return: void.
+ */
+static inline void DWT_vStartDeadlineCycles(DWT_strDeadline_t* Add_pstrDeadline, uint64_t Copy_u64Cycles)
+{
+	DWT_vStartCycleCounter();
+	Add_pstrDeadline->lastCycles = DWT->DWT_CYCCNT;
+	Add_pstrDeadline->remainingCycles = Copy_u64Cycles;
+}
+
+
+
+/****************************************************************************************/
+/*								Functions' Implementation								*/
+/****************************************************************************************/
+
+
+/**
+ *@brief : Function to enable the DWT unit and start its cycle counter (CYCCNT) from zero.
+ *@param : void.
+ *@return: Error status.
+ */
+DWT_enuErrorStatus_t DWT_enuInit(void)
+{
+	DWT_enuErrorStatus_t LOC_enuErrorStatus = DWT_enuOk;
+
+	/* The DWT registers can't be accessed before enabling the trace in the DEMCR */
+	*DEMCR |= DEMCR_TRCENA_SET_MASK;
+
+	/* Check that this core has a cycle counter */
+	if (DWT->DWT_CTRL & DWT_CTRL_NOCYCCNT_SET_MASK)
+	{
+		LOC_enuErrorStatus = DWT_enuCycleCounterNotSupported;
+	}
+	else
+	{
+		/* Start counting from zero */
+		DWT->DWT_CYCCNT = 0;
+		DWT->DWT_CTRL |= DWT_CTRL_CYCCNTENA_SET_MASK;
+	}
+
+	return LOC_enuErrorStatus;
+}
+
+
+/**
+ *@brief : Function to get the number of core clock cycles counted by the cycle counter, it wraps
+ * 			around every 2^32 cycles (about 51 seconds at 84 MHz).
+ *@param : void.
+ *@return: The cycle counter value.
+ */
+uint32_t DWT_u32GetCycleCount(void)
+{
+	return DWT->DWT_CYCCNT;
+}
+
+
+/**
+ *@brief : Function to tell the driver the core clock (HCLK), the delays and the deadlines are converted
+ * 			to cycles with it. It's 16 MHz (HSI) after reset and it's updated by the RCC driver when it
+ * 			switches the system clock or the AHB pre-scaler.
+ *@param : The core clock in Hz.
+ *@return: Error status.
+ */
+DWT_enuErrorStatus_t DWT_enuSetCoreClock(uint32_t Copy_u32CoreClock)
+{
+	DWT_enuErrorStatus_t LOC_enuErrorStatus = DWT_enuOk;
+
+	if (Copy_u32CoreClock == 0)
+	{
+		LOC_enuErrorStatus = DWT_enuNotOk;
+	}
+	else
+	{
+		GLB_u32CoreClock = Copy_u32CoreClock;
+	}
+
+	return LOC_enuErrorStatus;
+}
+
+
+/**
+ *@brief : Function to get the core clock the delays and the deadlines are converted with.
+ *@param : void.
+ *@return: The core clock in Hz.
+ */
+uint32_t DWT_u32GetCoreClock(void)
+{
+	return GLB_u32CoreClock;
+}
+
+
+/**
+ *@brief : Function to busy-wait for at least the given microseconds, the cycle counter is started if it
+ * 			isn't counting. Interrupts that come during the wait lengthen it only if they take longer
+ * 			than the rest of it.
+ *@param : The delay in microseconds.
+ *@return: void.
+ */
+void DWT_vDelayMicroSec(uint32_t Copy_u32DelayUS)
+{
+	DWT_strDeadline_t LOC_strDeadline;
+
+	DWT_vStartDeadlineCycles(&LOC_strDeadline, DWT_u64ToCycles(Copy_u32DelayUS, DWT_US_PER_SECOND));
+	while (DWT_u8IsDeadlinePassed(&LOC_strDeadline) == 0)
+	{
+		/* Wait */
+	}
+}
+
+
+/**
+ *@brief : Function to busy-wait for at least the given nanoseconds, rounded up to a whole core cycle.
+ * 			The call itself takes a few tens of cycles, so short delays are longer than asked for.
+ *@param : The delay in nanoseconds.
+ *@return: void.
+ */
+void DWT_vDelayNanoSec(uint32_t Copy_u32DelayNS)
+{
+	DWT_strDeadline_t LOC_strDeadline;
+
+	DWT_vStartDeadlineCycles(&LOC_strDeadline, DWT_u64ToCycles(Copy_u32DelayNS, DWT_NS_PER_SECOND));
+	while (DWT_u8IsDeadlinePassed(&LOC_strDeadline) == 0)
+	{
+		/* Wait */
+	}
+}
+
+
+/**
+ *@brief : Function to start a deadline that passes after the given microseconds, the cycle counter is
+ * 			started if it isn't counting. A deadline of any length works as long as it's checked at
+ * 			least once every 2^32 cycles.
+ *@param : The deadline and its timeout in microseconds.
+ *@return: void.
+ */
+void DWT_vStartDeadline(DWT_strDeadline_t* Add_pstrDeadline, uint32_t Copy_u32TimeoutUS)
+{
+	if (Add_pstrDeadline != NULL_PTR)
+	{
+		DWT_vStartDeadlineCycles(Add_pstrDeadline, DWT_u64ToCycles(Copy_u32TimeoutUS, DWT_US_PER_SECOND));
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+
+/**
+ *@brief : Function to check if a deadline has passed.
+ *@param : The deadline.
+ *@return: 1 if it has passed, 0 otherwise.
+ */
+uint8_t DWT_u8IsDeadlinePassed(DWT_strDeadline_t* Add_pstrDeadline)
+{
+	uint8_t LOC_u8Passed = 1;
+	uint32_t LOC_u32Now;
+	uint32_t LOC_u32Elapsed;
+
+	if (Add_pstrDeadline != NULL_PTR)
+	{
+		/* The cycles passed since the last check are taken from the remaining ones, so the counter
+		 * wrapping around doesn't matter as long as the checks are less than 2^32 cycles apart */
+		LOC_u32Now = DWT->DWT_CYCCNT;
+		LOC_u32Elapsed = LOC_u32Now - Add_pstrDeadline->lastCycles;
+		Add_pstrDeadline->lastCycles = LOC_u32Now;
+		if (LOC_u32Elapsed >= Add_pstrDeadline->remainingCycles)
+		{
+			Add_pstrDeadline->remainingCycles = 0;
+		}
+		else
+		{
+			Add_pstrDeadline->remainingCycles -= LOC_u32Elapsed;
+			LOC_u8Passed = 0;
+		}
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	return LOC_u8Passed;
+}
@@ -69,6 +69,22 @@
 
 
 #define NUM_OF_PORT_S_PINS					(16UL)
+#define PORT_PINS_MASK						(0x0000FFFFUL)
+
+/* The ports are 0x400 bytes apart from GPIOA, a port's address has none of the lower 10 bits set and its
+ * index is its distance from GPIOA shifted by 10, GPIOA..GPIOE take 0..4 and GPIOH takes 7 */
+#define PORT_ADDRESS_STEP_SHIFT				(10UL)
+#define PORT_ADDRESS_STEP_MASK				(0x3FFUL)
+#define NUM_OF_PORT_INDICES					(((GPIO_PORTH - GPIO_PORTA) >> PORT_ADDRESS_STEP_SHIFT) + 1)
+
+
+#if ((GPIO_BUS_MAX_WIDTH != 4) && (GPIO_BUS_MAX_WIDTH != 8) && (GPIO_BUS_MAX_WIDTH != 12) && (GPIO_BUS_MAX_WIDTH != 16))
+#error "INVALID GPIO_BUS_MAX_WIDTH is selected :(\nIt must be 4, 8, 12 or 16"
+#endif
+
+#if ((GPIO_BUS_MAX_PORTS < 1) || (GPIO_BUS_MAX_PORTS > 6))
+#error "INVALID GPIO_BUS_MAX_PORTS is selected :(\nIt must be from 1 up to 6"
+#endif
 
 
 
@@ -91,6 +107,20 @@ typedef struct{
 }GPIO_strRegsiters_t;
 
 
+/* RAM image of the bits GPIO_enuInitPins changes in a port, "Mask" has the bits of the configured pins
+ * and "Value" their new value */
+typedef struct{
+	uint32_t MODERMask;
+	uint32_t MODERValue;
+	uint32_t OTYPERMask;
+	uint32_t OTYPERValue;
+	uint32_t PUPDRMask;
+	uint32_t PUPDRValue;
+	uint32_t OSPEEDRMask;
+	uint32_t OSPEEDRValue;
+}GPIO_strPortImage_t;
+
+
 
 /****************************************************************************************/
 /*									Variables's Declaration								*/
@@ -215,6 +245,232 @@ GPIO_enuErrorStatus_t GPIO_enuInitPin(GPIO_strPinConfig_t* Add_strPinConfig)
 
 
 
+/**
+ *@brief : Function to Configure many GPIO pins together. All the configurations are checked before any
+ * 			register is touched, then the pins of each port are merged into one image of the port in RAM
+ * 			and each of its registers is written once: OSPEEDR, OTYPER and PUPDR first and MODER last, so
+ * 			no pin changes its mode before its type, pull and speed are set.
+ *@param : Address of an array of pins' configurations, Number of the configurations.
+ *@return: Error status.
+ */
+GPIO_enuErrorStatus_t GPIO_enuInitPins(const GPIO_strPinConfig_t* Add_pstrPinsConfig, uint32_t Copy_u32PinsNumber)
+{
+	GPIO_enuErrorStatus_t LOC_enuErrorStatus = GPIO_enuOk;
+	GPIO_strPortImage_t LOC_arrPortsImages[NUM_OF_PORT_INDICES] = {{0}};
+	GPIO_strPortImage_t* LOC_pstrImage;
+	GPIO_strRegsiters_t* LOC_pstrPort;
+	const GPIO_strPinConfig_t* LOC_pstrPin;
+	uint32_t LOC_u32Counter;
+
+	if (Add_pstrPinsConfig == NULL_PTR)
+	{
+		LOC_enuErrorStatus = GPIO_enuNullPointer;
+	}
+	else
+	{
+		/* First pass: check every configuration and merge it in the image of its port */
+		for (LOC_u32Counter = 0; (LOC_u32Counter < Copy_u32PinsNumber) && (LOC_enuErrorStatus == GPIO_enuOk); LOC_u32Counter++)
+		{
+			LOC_pstrPin = &Add_pstrPinsConfig[LOC_u32Counter];
+
+			if (((LOC_pstrPin->GPIO_port >= GPIO_PORTA) && (LOC_pstrPin->GPIO_port <= GPIO_PORTH))\
+				&& ((LOC_pstrPin->GPIO_port & PORT_ADDRESS_STEP_MASK) == 0)\
+				&& (LOC_pstrPin->GPIO_pin <= GPIO_PIN15) && (LOC_pstrPin->GPIO_speed <= GPIO_SPEED_VERY_HIGH)\
+				&& (LOC_pstrPin->GPIO_mode <= GPIO_MODE_ANALOG))
+			{
+				LOC_pstrImage = &LOC_arrPortsImages[(LOC_pstrPin->GPIO_port - GPIO_PORTA) >> PORT_ADDRESS_STEP_SHIFT];
+
+				/* The same bits as GPIO_enuInitPin, a pin that comes again overrides its earlier value */
+				LOC_pstrImage->MODERMask |= MODER_Y_SET_MASK << (NUM_OF_PIN_S_MODER_BITS * LOC_pstrPin->GPIO_pin);
+				LOC_pstrImage->MODERValue &= ~(MODER_Y_SET_MASK << (NUM_OF_PIN_S_MODER_BITS * LOC_pstrPin->GPIO_pin));
+				LOC_pstrImage->MODERValue |= ((LOC_pstrPin->GPIO_mode & SHAHER_MODER_BITS_MASK) >> SHAHER_MODER_BITS_SHIFT)\
+											<< (NUM_OF_PIN_S_MODER_BITS * LOC_pstrPin->GPIO_pin);
+
+				LOC_pstrImage->OTYPERMask |= OTYPER_Y_SET_MASK << LOC_pstrPin->GPIO_pin;
+				LOC_pstrImage->OTYPERValue &= ~(OTYPER_Y_SET_MASK << LOC_pstrPin->GPIO_pin);
+				LOC_pstrImage->OTYPERValue |= ((LOC_pstrPin->GPIO_mode & SHAHER_OTYPER_BIT_MASK) >> SHAHER_OTYPER_BIT_SHIFT)\
+											<< LOC_pstrPin->GPIO_pin;
+
+				LOC_pstrImage->PUPDRMask |= PUPDR_Y_SET_MASK << (NUM_OF_PIN_S_PUPDR_BITS * LOC_pstrPin->GPIO_pin);
+				LOC_pstrImage->PUPDRValue &= ~(PUPDR_Y_SET_MASK << (NUM_OF_PIN_S_PUPDR_BITS * LOC_pstrPin->GPIO_pin));
+				LOC_pstrImage->PUPDRValue |= (LOC_pstrPin->GPIO_mode & SHAHER_PUPDR_BITS_MASK)\
+											<< (NUM_OF_PIN_S_PUPDR_BITS * LOC_pstrPin->GPIO_pin);
+
+				LOC_pstrImage->OSPEEDRMask |= OSPEEDR_Y_SET_MASK << (NUM_OF_PIN_S_OSPEEDER_BITS * LOC_pstrPin->GPIO_pin);
+				LOC_pstrImage->OSPEEDRValue &= ~(OSPEEDR_Y_SET_MASK << (NUM_OF_PIN_S_OSPEEDER_BITS * LOC_pstrPin->GPIO_pin));
+				LOC_pstrImage->OSPEEDRValue |= LOC_pstrPin->GPIO_speed << (NUM_OF_PIN_S_OSPEEDER_BITS * LOC_pstrPin->GPIO_pin);
+			}
+			else
+			{
+				/* Seems that one or more input parameter is not in the specified range, nothing is written */
+				LOC_enuErrorStatus = GPIO_enuNotOk;
+			}
+		}
+
+		/* Second pass: one read-modify-write of each register of each used port */
+		for (LOC_u32Counter = 0; (LOC_u32Counter < NUM_OF_PORT_INDICES) && (LOC_enuErrorStatus == GPIO_enuOk); LOC_u32Counter++)
+		{
+			LOC_pstrImage = &LOC_arrPortsImages[LOC_u32Counter];
+
+			if (LOC_pstrImage->MODERMask != 0)
+			{
+				LOC_pstrPort = (GPIO_strRegsiters_t*)(GPIO_PORTA + (LOC_u32Counter << PORT_ADDRESS_STEP_SHIFT));
+
+				LOC_pstrPort->OSPEEDR = (LOC_pstrPort->OSPEEDR & ~LOC_pstrImage->OSPEEDRMask) | LOC_pstrImage->OSPEEDRValue;
+				LOC_pstrPort->OTYPER = (LOC_pstrPort->OTYPER & ~LOC_pstrImage->OTYPERMask) | LOC_pstrImage->OTYPERValue;
+				LOC_pstrPort->PUPDR = (LOC_pstrPort->PUPDR & ~LOC_pstrImage->PUPDRMask) | LOC_pstrImage->PUPDRValue;
+				LOC_pstrPort->MODER = (LOC_pstrPort->MODER & ~LOC_pstrImage->MODERMask) | LOC_pstrImage->MODERValue;
+			}
+			else
+			{
+				/* No pin of this port is configured */
+			}
+		}
+	}
+
+	return LOC_enuErrorStatus;
+}
+
+
+/**
+ *@brief  : Function to validate the lines of a parallel bus once and build its BSRR tables, the pins
+ * 			must be configured as outputs separately.
+ *@param  : Address of the bus, Address of an array of its lines (the line i carries the bit i of the
+ * 			values), Number of its lines (1 ~ GPIO_BUS_MAX_WIDTH, on up to GPIO_BUS_MAX_PORTS ports).
+ *@return : Error status.
+ */
+GPIO_enuErrorStatus_t GPIO_enuInitBus(GPIO_strBus_t* Add_pstrBus, const GPIO_strBusPin_t* Add_pstrPins,\
+									uint8_t Copy_u8Width)
+{
+	GPIO_enuErrorStatus_t LOC_enuErrorStatus = GPIO_enuOk;
+	uint32_t LOC_arrPorts[GPIO_BUS_MAX_PORTS];
+	/* The pins already taken on each port, a line can't share a pin with another line */
+	uint32_t LOC_arrUsedPins[GPIO_BUS_MAX_PORTS] = {0};
+	uint32_t LOC_u32PortsNumber = 0;
+	uint32_t LOC_u32Line;
+	uint32_t LOC_u32Port;
+	uint32_t LOC_u32Nibble;
+	uint32_t LOC_u32NibbleValue;
+	uint32_t LOC_u32BSRRWord;
+
+	if ((Add_pstrBus == NULL_PTR) || (Add_pstrPins == NULL_PTR))
+	{
+		LOC_enuErrorStatus = GPIO_enuNullPointer;
+	}
+	else if ((Copy_u8Width == 0) || (Copy_u8Width > GPIO_BUS_MAX_WIDTH))
+	{
+		LOC_enuErrorStatus = GPIO_enuNotOk;
+	}
+	else
+	{
+		/* First, check the lines and gather the ports of the bus */
+		for (LOC_u32Line = 0; (LOC_u32Line < Copy_u8Width) && (LOC_enuErrorStatus == GPIO_enuOk); LOC_u32Line++)
+		{
+			if (((Add_pstrPins[LOC_u32Line].GPIO_port >= GPIO_PORTA) && (Add_pstrPins[LOC_u32Line].GPIO_port <= GPIO_PORTH))\
+				&& ((Add_pstrPins[LOC_u32Line].GPIO_port & PORT_ADDRESS_STEP_MASK) == 0)\
+				&& (Add_pstrPins[LOC_u32Line].GPIO_pin <= GPIO_PIN15))
+			{
+				for (LOC_u32Port = 0; (LOC_u32Port < LOC_u32PortsNumber)\
+									&& (LOC_arrPorts[LOC_u32Port] != Add_pstrPins[LOC_u32Line].GPIO_port); LOC_u32Port++)
+				{
+					/* Looking for the line's port among the ports found so far */
+				}
+
+				if (LOC_u32Port == LOC_u32PortsNumber)
+				{
+					/* A new port, if there is still room for it */
+					if (LOC_u32PortsNumber < GPIO_BUS_MAX_PORTS)
+					{
+						LOC_arrPorts[LOC_u32PortsNumber] = Add_pstrPins[LOC_u32Line].GPIO_port;
+						LOC_u32PortsNumber++;
+					}
+					else
+					{
+						LOC_enuErrorStatus = GPIO_enuNotOk;
+					}
+				}
+				else
+				{
+					/* Do Nothing */
+				}
+
+				if (LOC_enuErrorStatus == GPIO_enuOk)
+				{
+					if ((LOC_arrUsedPins[LOC_u32Port] & (1UL << Add_pstrPins[LOC_u32Line].GPIO_pin)) == 0)
+					{
+						LOC_arrUsedPins[LOC_u32Port] |= 1UL << Add_pstrPins[LOC_u32Line].GPIO_pin;
+					}
+					else
+					{
+						/* Two lines on the same pin */
+						LOC_enuErrorStatus = GPIO_enuNotOk;
+					}
+				}
+				else
+				{
+					/* Do Nothing */
+				}
+			}
+			else
+			{
+				/* Seems that one or more input parameter is not in the specified range, return error */
+				LOC_enuErrorStatus = GPIO_enuNotOk;
+			}
+		}
+
+		/* Then build the tables, the BSRR word of a nibble's value sets the port's lines of the nibble
+		 * whose bits are 1 and resets those whose bits are 0, the lines of the other ports are left out */
+		if (LOC_enuErrorStatus == GPIO_enuOk)
+		{
+			Add_pstrBus->portsNumber = (uint8_t)LOC_u32PortsNumber;
+			Add_pstrBus->nibblesNumber = (uint8_t)((Copy_u8Width + GPIO_BUS_NIBBLE_BITS - 1) / GPIO_BUS_NIBBLE_BITS);
+
+			for (LOC_u32Port = 0; LOC_u32Port < LOC_u32PortsNumber; LOC_u32Port++)
+			{
+				Add_pstrBus->BSRR[LOC_u32Port] = &(((GPIO_strRegsiters_t*)(LOC_arrPorts[LOC_u32Port]))->BSRR);
+
+				for (LOC_u32Nibble = 0; LOC_u32Nibble < Add_pstrBus->nibblesNumber; LOC_u32Nibble++)
+				{
+					for (LOC_u32NibbleValue = 0; LOC_u32NibbleValue < GPIO_BUS_NIBBLE_VALUES; LOC_u32NibbleValue++)
+					{
+						LOC_u32BSRRWord = 0;
+
+						for (LOC_u32Line = LOC_u32Nibble * GPIO_BUS_NIBBLE_BITS;\
+							(LOC_u32Line < ((LOC_u32Nibble + 1) * GPIO_BUS_NIBBLE_BITS)) && (LOC_u32Line < Copy_u8Width);\
+							LOC_u32Line++)
+						{
+							if (Add_pstrPins[LOC_u32Line].GPIO_port == LOC_arrPorts[LOC_u32Port])
+							{
+								if ((LOC_u32NibbleValue >> (LOC_u32Line % GPIO_BUS_NIBBLE_BITS)) & 1UL)
+								{
+									LOC_u32BSRRWord |= BSRR_Y_SET_MASK << Add_pstrPins[LOC_u32Line].GPIO_pin;
+								}
+								else
+								{
+									LOC_u32BSRRWord |= BSRR_Y_SET_MASK << (Add_pstrPins[LOC_u32Line].GPIO_pin + NUM_OF_PORT_S_PINS);
+								}
+							}
+							else
+							{
+								/* Do Nothing */
+							}
+						}
+
+						Add_pstrBus->BSRRTable[LOC_u32Port][LOC_u32Nibble][LOC_u32NibbleValue] = LOC_u32BSRRWord;
+					}
+				}
+			}
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+
+	return LOC_enuErrorStatus;
+}
+
+
 /**
  *@brief : Function to Configure the GPIO' pins to an alternate function.
  *@param : 	Address of the structure that contains port number, pin number, speed and direction mode.
@@ -420,8 +676,95 @@ GPIO_enuErrorStatus_t GPIO_enuGetPinVal(uint32_t Copy_u32PortNum, uint32_t Copy_
 	{
 		/* Seems that all the parameters are passed correctly in the range, let's go */
 
-		/* Assign the value in the bit corresponding to the passed pin inside the passed pointer */
-		*Add_Pu32PinVal = ((GPIO_strRegsiters_t*)(Copy_u32PortNum))->IDR & (1 << Copy_u32PinNum);
+		/* Read the pin's bit of the IDR through its bit-band alias, so the value is
+		 * GPIO_PIN_VAL_LOW or GPIO_PIN_VAL_HIGH whatever the pin number is */
+		*Add_Pu32PinVal = *(volatile uint32_t*)BITBAND_PERIPH_ALIAS_ADDRESS(Copy_u32PortNum + GPIO_IDR_OFFSET, Copy_u32PinNum);
+	}
+	else
+	{
+		/* Seems that one or more input parameter is not in the specified range, return error */
+		LOC_enuErrorStatus = GPIO_enuNotOk;
+	}
+
+	return LOC_enuErrorStatus;
+}
+
+
+/**
+ *@brief  : Function to Set any group of a port's pins to their values at the same instant.
+ *@param  : Port Number, Mask of the pins to change (bit n is pin n), their values (bit n is the value of
+ * 			pin n, the bits out of the mask are ignored).
+ *@return : Error status.
+ */
+GPIO_enuErrorStatus_t GPIO_enuSetPortMasked(uint32_t Copy_u32PortNum, uint32_t Copy_u32Mask,\
+											uint32_t Copy_u32Value)
+{
+	GPIO_enuErrorStatus_t LOC_enuErrorStatus = GPIO_enuOk;
+
+	/* We should check on the passed parameters that it is in the range */
+	if (((Copy_u32PortNum >= GPIO_PORTA) && (Copy_u32PortNum <= GPIO_PORTH))\
+		&& ((Copy_u32PortNum & PORT_ADDRESS_STEP_MASK) == 0) && ((Copy_u32Mask & ~PORT_PINS_MASK) == 0))
+	{
+		/* The pins to be high go in the set bits of the BSRR (15:0) and the pins to be low go in
+		 * its reset bits (31:16), so one write changes all of them together */
+		((GPIO_strRegsiters_t*)(Copy_u32PortNum))->BSRR = (Copy_u32Value & Copy_u32Mask)\
+				| ((~Copy_u32Value & Copy_u32Mask) << NUM_OF_PORT_S_PINS);
+	}
+	else
+	{
+		/* Seems that one or more input parameter is not in the specified range, return error */
+		LOC_enuErrorStatus = GPIO_enuNotOk;
+	}
+
+	return LOC_enuErrorStatus;
+}
+
+/**
+ *@brief  : Function to Read the Logic State of all the pins of a port at the same instant.
+ *@param  : Port Number, Pointer to return the pins' states (bit n is the state of pin n).
+ *@return : Error status.
+ */
+GPIO_enuErrorStatus_t GPIO_enuGetPort(uint32_t Copy_u32PortNum, uint32_t* Add_Pu32PortVal)
+{
+	GPIO_enuErrorStatus_t LOC_enuErrorStatus = GPIO_enuOk;
+
+	/* We should check on the passed parameters that it is in the range */
+	if (((Copy_u32PortNum >= GPIO_PORTA) && (Copy_u32PortNum <= GPIO_PORTH))\
+		&& ((Copy_u32PortNum & PORT_ADDRESS_STEP_MASK) == 0) && (Add_Pu32PortVal != NULL_PTR))
+	{
+		*Add_Pu32PortVal = ((GPIO_strRegsiters_t*)(Copy_u32PortNum))->IDR & PORT_PINS_MASK;
+	}
+	else
+	{
+		/* Seems that one or more input parameter is not in the specified range, return error */
+		LOC_enuErrorStatus = GPIO_enuNotOk;
+	}
+
+	return LOC_enuErrorStatus;
+}
+
+/**
+ *@brief  : Function to validate a pin once and fill its handle for the inline accessors.
+ *@param  : Address of the handle, Port Number, Pin Number.
+ *@return : Error status.
+ */
+GPIO_enuErrorStatus_t GPIO_enuInitPinHandle(GPIO_strPinHandle_t* Add_pstrPinHandle, uint32_t Copy_u32PortNum,\
+											uint32_t Copy_u32PinNum)
+{
+	GPIO_enuErrorStatus_t LOC_enuErrorStatus = GPIO_enuOk;
+
+	if (Add_pstrPinHandle == NULL_PTR)
+	{
+		LOC_enuErrorStatus = GPIO_enuNullPointer;
+	}
+	/* We should check on the passed parameters that it is in the range */
+	else if (((Copy_u32PortNum >= GPIO_PORTA) && (Copy_u32PortNum <= GPIO_PORTH))\
+			&& ((Copy_u32PortNum & PORT_ADDRESS_STEP_MASK) == 0) && (Copy_u32PinNum <= GPIO_PIN15))
+	{
+		/* Everything the accessors need is computed here once */
+		Add_pstrPinHandle->BSRR = &(((GPIO_strRegsiters_t*)(Copy_u32PortNum))->BSRR);
+		Add_pstrPinHandle->setMask = BSRR_Y_SET_MASK << Copy_u32PinNum;
+		Add_pstrPinHandle->resetMask = BSRR_Y_SET_MASK << (Copy_u32PinNum + NUM_OF_PORT_S_PINS);
 	}
 	else
 	{
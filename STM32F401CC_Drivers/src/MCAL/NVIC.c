@@ -50,6 +50,14 @@
 /* Number of bits specified for each field in each of the IPRx registers */
 #define FIELDS_PER_REGISTER_BITS_NUMBER					(8)
 
+/* ICSR PENDSVSET bit set mask */
+#define SCB_ICSR_PENDSVSET_SET_MASK						(0x10000000UL)
+/* ICSR PENDSTSET bit set mask */
+#define SCB_ICSR_PENDSTSET_SET_MASK						(0x04000000UL)
+
+/* Number of the first system handler that has a priority field in the SHPRx registers */
+#define SCB_SHPR_FIRST_SYSTEM_HANDLER					(4)
+
 /* Position of the PRIGROUP bits in the AIRCR register */
 #define SCB_AIRCR_PRIGROUP_BITS_POSITION				(8)
 /* Position of the VECTKEYSTAT/ VECTKEY bits in the AIRCR register */
@@ -104,7 +112,8 @@ typedef struct {
 	volatile uint32_t AIRCR;
 	volatile uint32_t SCR;
 	volatile uint32_t CCR;
-	volatile uint32_t SHPR[3];
+	/* One byte for the priority of each system handler, starting from the MemManage handler (number 4) */
+	volatile uint8_t SHPR[12];
 	volatile uint32_t SHCSR;
 	volatile uint32_t CFSR;
 	volatile uint32_t HFSR;
@@ -133,6 +142,91 @@ static SCB_strRegsiters_t* const SCB = (SCB_strRegsiters_t*)SCB_BASE_ADDRESS;
 /****************************************************************************************/
 
 
+/**
+ *@brief : Function to build the value of a priority field from the preemption and subpriority levels,
+ * 			as the current priority group says.
+ *@param : Preemption level.
+ *@param : SubPriority level.
+ *@param : Pointer in which the value of the priority field will be assigned.
+ *@return: Error status.
+ */
+static NVIC_enuErrorStatus_t NVIC_enuEncodePriority(uint8_t PREEMPTION_LEVEL_, uint8_t SUBPRIORITY_LEVEL_, uint8_t* Add_pu8Priority)
+{
+	NVIC_enuErrorStatus_t LOC_enuErrorStatus = NVIC_enuOk;
+
+	/* Create a local variable to assign in it the value of the PRIGROUP bits */
+	uint32_t LOC_priorityGroup;
+
+	/* Check on the inputed preemption level if it in the specified range or not, the levels are unsigned
+	 * so only the upper limit is checked */
+	if (PREEMPTION_LEVEL_ > PREEMPTION_LEVEL_15)
+	{
+		/* if not return an error */
+		LOC_enuErrorStatus = NVIC_enuWrongPreemptionLevel;
+	}
+	/* Check on the inputed subPriority level if it in the specified range or not */
+	else if (SUBPRIORITY_LEVEL_ > SUBPRIORITY_LEVEL_15)
+	{
+		/* if not return an error */
+		LOC_enuErrorStatus = NVIC_enuWrongSubPriorityLevel;
+	}
+	else if (NVIC_GetPriorityGrouping(&LOC_priorityGroup) == NVIC_enuOk)
+	{
+		/* NVIC_GetPriorityGrouping returns the PRIGROUP bits shifted down, while the options are
+		 * written as they are in the AIRCR register */
+		switch (LOC_priorityGroup << SCB_AIRCR_PRIGROUP_BITS_POSITION)
+		{
+		case PG_GPB_7_TO_5_SPB_4_VALUE:
+			/* Check that the user entered values that can be assigned in the PRIGROUP bits */
+			if ((PREEMPTION_LEVEL_ <= PREEMPTION_LEVEL_7) && (SUBPRIORITY_LEVEL_ <= SUBPRIORITY_LEVEL_1))
+			{
+				*Add_pu8Priority = ((PREEMPTION_LEVEL_ << 1) | SUBPRIORITY_LEVEL_) << NVIC_PR_NON_IMP_BITS;
+			}
+			else
+			{
+				LOC_enuErrorStatus = NVIC_enuNotOk;
+			}
+			break;
+		case PG_GPB_7_TO_6_SPB_5_TO_4_VALUE:
+			/* Check that the user entered values that can be assigned in the PRIGROUP bits */
+			if ((PREEMPTION_LEVEL_ <= PREEMPTION_LEVEL_3) && (SUBPRIORITY_LEVEL_ <= SUBPRIORITY_LEVEL_3))
+			{
+				*Add_pu8Priority = ((PREEMPTION_LEVEL_ << 2) | SUBPRIORITY_LEVEL_) << NVIC_PR_NON_IMP_BITS;
+			}
+			else
+			{
+				LOC_enuErrorStatus = NVIC_enuNotOk;
+			}
+			break;
+		case PG_GPB_7_SPB_6_TO_4_VALUE:
+			/* Check that the user entered values that can be assigned in the PRIGROUP bits */
+			if ((PREEMPTION_LEVEL_ <= PREEMPTION_LEVEL_1) && (SUBPRIORITY_LEVEL_ <= SUBPRIORITY_LEVEL_7))
+			{
+				*Add_pu8Priority = ((PREEMPTION_LEVEL_ << 3) | SUBPRIORITY_LEVEL_) << NVIC_PR_NON_IMP_BITS;
+			}
+			else
+			{
+				LOC_enuErrorStatus = NVIC_enuNotOk;
+			}
+			break;
+		case PG_GPB_NONE_SPB_7_TO_4_VALUE:
+			*Add_pu8Priority = SUBPRIORITY_LEVEL_ << NVIC_PR_NON_IMP_BITS;
+			break;
+		default:
+			/* PRIGROUP values from 0 up to 3 all give the four implemented bits to the group priority */
+			*Add_pu8Priority = PREEMPTION_LEVEL_ << NVIC_PR_NON_IMP_BITS;
+			break;
+		}
+	}
+	else
+	{
+		LOC_enuErrorStatus = NVIC_enuNotOk;
+	}
+
+	return LOC_enuErrorStatus;
+}
+
+
 
 
 
@@ -166,7 +260,7 @@ NVIC_enuErrorStatus_t NVIC_EnableIRQ(IRQs_t IRQ_)
 		/* Seems like the user entered a valid value for an interrupt request */
 
 		/* Set the bit corresponding to the passed IRQ in the right ISER register */
-		NVIC->ISER[IRQ_ / REGISTER_WIDTH] |= (1 << (IRQ_ % REGISTER_WIDTH));
+		NVIC->ISER[IRQ_ / REGISTER_WIDTH] = (1UL << (IRQ_ % REGISTER_WIDTH));
 	}
 
 	return LOC_enuErrorStatus;
@@ -196,7 +290,7 @@ NVIC_enuErrorStatus_t NVIC_DisableIRQ(IRQs_t IRQ_)
 		/* Seems like the user entered a valid value for an interrupt request */
 
 		/* set the bit corresponding to the passed IRQ in the right ICER register to disable the IRQ */
-		NVIC->ICER[IRQ_ / REGISTER_WIDTH] |= (1 << (IRQ_ % REGISTER_WIDTH));
+		NVIC->ICER[IRQ_ / REGISTER_WIDTH] = (1UL << (IRQ_ % REGISTER_WIDTH));
 	}
 
 	return LOC_enuErrorStatus;
@@ -225,8 +319,9 @@ NVIC_enuErrorStatus_t NVIC_SetPendingIRQ(IRQs_t IRQ_)
 	{
 		/* Seems like the user entered a valid value for an interrupt request */
 
-		/* set the bit corresponding to the passed IRQ in the right ISPR register */
-		NVIC->ISPR[IRQ_ / REGISTER_WIDTH] |= (1 << (IRQ_ % REGISTER_WIDTH));
+		/* set the bit corresponding to the passed IRQ in the right ISPR register, writing zeros has no effect
+		 * so it's written directly (read-modify-write could pend again an IRQ that is taken in between) */
+		NVIC->ISPR[IRQ_ / REGISTER_WIDTH] = (1UL << (IRQ_ % REGISTER_WIDTH));
 	}
 
 	return LOC_enuErrorStatus;
@@ -256,7 +351,7 @@ NVIC_enuErrorStatus_t NVIC_ClearPendingIRQ(IRQs_t IRQ_)
 		/* Seems like the user entered a valid value for an interrupt request */
 
 		/* set the bit corresponding to the passed IRQ in the right ICPR register to clear the pending of the IRQ */
-		NVIC->ICPR[IRQ_ / REGISTER_WIDTH] |= (1 << (IRQ_ % REGISTER_WIDTH));
+		NVIC->ICPR[IRQ_ / REGISTER_WIDTH] = (1UL << (IRQ_ % REGISTER_WIDTH));
 	}
 
 	return LOC_enuErrorStatus;
@@ -355,103 +450,23 @@ NVIC_enuErrorStatus_t NVIC_SetPriorityIRQ(IRQs_t IRQ_, uint8_t PREEMPTION_LEVEL_
 		/* If the user entered an invalid value for the interrupt request, return NOT OK in the error status */
 		LOC_enuErrorStatus = NVIC_enuNotOk;
 	}
-	/* Check on the inputed preemption level if it in the specified range or not */
-	/* The compiler will generate the following warning:
-	 * "comparison is always false due to limited range of data type [-Wtype-limits]"
-	 * ignore it */
-	else if ((PREEMPTION_LEVEL_ < PREEMPTION_LEVEL_0) || (PREEMPTION_LEVEL_ > PREEMPTION_LEVEL_15))
-	{
-		/* if not return an error */
-		LOC_enuErrorStatus = NVIC_enuWrongPreemptionLevel;
-	}
-	/* Check on the inputed subPriority level if it in the specified range or not */
-	/* The compiler will generate the following warning:
-	 * "comparison is always false due to limited range of data type [-Wtype-limits]"
-	 * ignore it */
-	else if ((SUBPRIORITY_LEVEL_ < SUBPRIORITY_LEVEL_0) || (SUBPRIORITY_LEVEL_ > SUBPRIORITY_LEVEL_15))
-	{
-		/* if not return an error */
-		LOC_enuErrorStatus = NVIC_enuWrongSubPriorityLevel;
-	}
 	else
 	{
-		/* Seems like the user entered a valid value for an interrupt request and for a priority level */
+		/* Seems like the user entered a valid value for an interrupt request, the priority levels are
+		 * checked while they are encoded */
 
-		/* Create a local variable to assign in it the value of the PRIGROUP bits */
-		uint32_t LOC_priorityGroup;
-		if (NVIC_GetPriorityGrouping(&LOC_priorityGroup) == NVIC_enuOk)
-		{
-
-			/* Create a local variable as an image of the real register */
-			uint32_t LOC_u32LocalReg = NVIC->IPR[IRQ_ / IPR_FIELDS_PER_REGISTER];
-			/* Clean the bits before assigning in it */
-			LOC_u32LocalReg &= ~(NVIC_IPRX_IP_N_SET_MASK << ((IRQ_ % IPR_FIELDS_PER_REGISTER) * FIELDS_PER_REGISTER_BITS_NUMBER));
+		/* Create a local variable to assign in it the value of the priority field */
+		uint8_t LOC_u8Priority;
 
-			/* if the function works properly and it returns with error status equals OK, We can no continue */
-			switch (LOC_priorityGroup)
-			{
-			case PG_GPB_7_TO_4_SPB_NONE_VALUE:
-				/* Assign the passed values in the local variable */
-				LOC_u32LocalReg |= PREEMPTION_LEVEL_ << (((IRQ_ % IPR_FIELDS_PER_REGISTER) * FIELDS_PER_REGISTER_BITS_NUMBER) + NVIC_PR_NON_IMP_BITS);
-				break;
-			case PG_GPB_7_TO_5_SPB_4_VALUE:
-				/* Check that the user entered values that can be assigned in the PRIGROUP bits */
-				if ((PREEMPTION_LEVEL_ <= PREEMPTION_LEVEL_7) && (SUBPRIORITY_LEVEL_ <= SUBPRIORITY_LEVEL_1))
-				{
-					/* Assign the passed values in the local variable */
-					LOC_u32LocalReg |= ((PREEMPTION_LEVEL_ << 1) | SUBPRIORITY_LEVEL_) << (((IRQ_ % IPR_FIELDS_PER_REGISTER) * FIELDS_PER_REGISTER_BITS_NUMBER) + NVIC_PR_NON_IMP_BITS);
-				}
-				else
-				{
-					LOC_enuErrorStatus = NVIC_enuNotOk;
-				}
-				break;
-			case PG_GPB_7_TO_6_SPB_5_TO_4_VALUE:
-				/* Check that the user entered values that can be assigned in the PRIGROUP bits */
-				if ((PREEMPTION_LEVEL_ <= PREEMPTION_LEVEL_3) && (SUBPRIORITY_LEVEL_ <= SUBPRIORITY_LEVEL_3))
-				{
-					/* Assign the passed values in the local variable */
-					LOC_u32LocalReg |= ((PREEMPTION_LEVEL_ << 2) | SUBPRIORITY_LEVEL_) << (((IRQ_ % IPR_FIELDS_PER_REGISTER) * FIELDS_PER_REGISTER_BITS_NUMBER) + NVIC_PR_NON_IMP_BITS);
-				}
-				else
-				{
-					LOC_enuErrorStatus = NVIC_enuNotOk;
-				}
-				break;
-			case PG_GPB_7_SPB_6_TO_4_VALUE:
-				/* Check that the user entered values that can be assigned in the PRIGROUP bits */
-				if ((PREEMPTION_LEVEL_ <= PREEMPTION_LEVEL_1) && (SUBPRIORITY_LEVEL_ <= SUBPRIORITY_LEVEL_7))
-				{
-					/* Assign the passed values in the local variable */
-					LOC_u32LocalReg |= ((PREEMPTION_LEVEL_ << 3) | SUBPRIORITY_LEVEL_) << (((IRQ_ % IPR_FIELDS_PER_REGISTER) * FIELDS_PER_REGISTER_BITS_NUMBER) + NVIC_PR_NON_IMP_BITS);
-				}
-				else
-				{
-					LOC_enuErrorStatus = NVIC_enuNotOk;
-				}
-				break;
-			case PG_GPB_NONE_SPB_7_TO_4_VALUE:
-				/* Assign the passed values in the local variable */
-				LOC_u32LocalReg |= SUBPRIORITY_LEVEL_ << (((IRQ_ % IPR_FIELDS_PER_REGISTER) * FIELDS_PER_REGISTER_BITS_NUMBER) + NVIC_PR_NON_IMP_BITS);
-				break;
-			default:
-				/* The code shouldn't reach here */
-				break;
-			}
-			if (LOC_enuErrorStatus == NVIC_enuOk)
-			{
-				/* As We finish the configurations, We can assign directly in the
-				 * real register */
-				NVIC->IPR[IRQ_ / IPR_FIELDS_PER_REGISTER] = LOC_u32LocalReg;
-			}
-			else
-			{
-				/* Do nothing */
-			}
+		LOC_enuErrorStatus = NVIC_enuEncodePriority(PREEMPTION_LEVEL_, SUBPRIORITY_LEVEL_, &LOC_u8Priority);
+		if (LOC_enuErrorStatus == NVIC_enuOk)
+		{
+			/* Each IRQ has its own byte in the IPR registers */
+			NVIC->IPR[IRQ_] = LOC_u8Priority;
 		}
 		else
 		{
-			LOC_enuErrorStatus = NVIC_enuNotOk;
+			/* Do nothing */
 		}
 	}
 
@@ -486,8 +501,9 @@ NVIC_enuErrorStatus_t NVIC_GetPriorityIRQ(IRQs_t IRQ_, uint8_t* priorityLevel)
 	{
 		/* Seems like the user entered a valid value for an interrupt request, and didn't enter a NULL pointer, so we can deal with it */
 
-		/* Get the active bit state which is corresponding to the passed IRQ */
-		*priorityLevel = ((NVIC->IPR[IRQ_ / IPR_FIELDS_PER_REGISTER] & (NVIC_IPRX_IP_N_SET_MASK << ((IRQ_ % IPR_FIELDS_PER_REGISTER) * FIELDS_PER_REGISTER_BITS_NUMBER))) >> ((IRQ_ % IPR_FIELDS_PER_REGISTER) * FIELDS_PER_REGISTER_BITS_NUMBER));
+		/* Get the priority field which is corresponding to the passed IRQ, each IRQ has its own byte in the
+		 * IPR registers */
+		*priorityLevel = NVIC->IPR[IRQ_];
 	}
 
 	return LOC_enuErrorStatus;
@@ -597,3 +613,69 @@ NVIC_enuErrorStatus_t NVIC_GetPriorityGrouping(uint32_t* priorityGroup)
 	return LOC_enuErrorStatus;
 }
 
+
+/**
+ *@brief : Function to set the priority for a system handler.
+ *@param : System handler (SYSTEM_HANDLER_MEMMANAGE, SYSTEM_HANDLER_BUSFAULT, SYSTEM_HANDLER_USAGEFAULT,
+ * 			SYSTEM_HANDLER_SVCALL, SYSTEM_HANDLER_DEBUGMON, SYSTEM_HANDLER_PENDSV or SYSTEM_HANDLER_SYSTICK).
+ *@param : Preemption level.
+ *@param : SubPriority level.
+ *@return: Error status.
+ */
+NVIC_enuErrorStatus_t NVIC_SetPrioritySystemHandler(uint8_t SYSTEM_HANDLER_, uint8_t PREEMPTION_LEVEL_, uint8_t SUBPRIORITY_LEVEL_)
+{
+	NVIC_enuErrorStatus_t LOC_enuErrorStatus = NVIC_enuOk;
+
+	/* Create a local variable to assign in it the value of the priority field */
+	uint8_t LOC_u8Priority;
+
+	/* Check that the entered system handler has a priority field */
+	if ((SYSTEM_HANDLER_ != SYSTEM_HANDLER_MEMMANAGE) && (SYSTEM_HANDLER_ != SYSTEM_HANDLER_BUSFAULT) &&
+		(SYSTEM_HANDLER_ != SYSTEM_HANDLER_USAGEFAULT) && (SYSTEM_HANDLER_ != SYSTEM_HANDLER_SVCALL) &&
+		(SYSTEM_HANDLER_ != SYSTEM_HANDLER_DEBUGMON) && (SYSTEM_HANDLER_ != SYSTEM_HANDLER_PENDSV) &&
+		(SYSTEM_HANDLER_ != SYSTEM_HANDLER_SYSTICK))
+	{
+		LOC_enuErrorStatus = NVIC_enuNotOk;
+	}
+	else
+	{
+		LOC_enuErrorStatus = NVIC_enuEncodePriority(PREEMPTION_LEVEL_, SUBPRIORITY_LEVEL_, &LOC_u8Priority);
+		if (LOC_enuErrorStatus == NVIC_enuOk)
+		{
+			SCB->SHPR[SYSTEM_HANDLER_ - SCB_SHPR_FIRST_SYSTEM_HANDLER] = LOC_u8Priority;
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	}
+
+	return LOC_enuErrorStatus;
+}
+
+
+/**
+ *@brief : Function to set the pending bit for a system handler.
+ *@param : System handler (SYSTEM_HANDLER_PENDSV or SYSTEM_HANDLER_SYSTICK).
+ *@return: Error status.
+ */
+NVIC_enuErrorStatus_t NVIC_SetPendingSystemHandler(uint8_t SYSTEM_HANDLER_)
+{
+	NVIC_enuErrorStatus_t LOC_enuErrorStatus = NVIC_enuOk;
+
+	/* Writing zeros in the ICSR register has no effect, so the set bit is written directly */
+	if (SYSTEM_HANDLER_ == SYSTEM_HANDLER_PENDSV)
+	{
+		SCB->ICSR = SCB_ICSR_PENDSVSET_SET_MASK;
+	}
+	else if (SYSTEM_HANDLER_ == SYSTEM_HANDLER_SYSTICK)
+	{
+		SCB->ICSR = SCB_ICSR_PENDSTSET_SET_MASK;
+	}
+	else
+	{
+		LOC_enuErrorStatus = NVIC_enuNotOk;
+	}
+
+	return LOC_enuErrorStatus;
+}
@@ -19,6 +19,7 @@
 /****************************************************************************************/
 
 #include <MCAL/RCC.h>
+#include <MCAL/DWT.h>
 
 
 
@@ -61,6 +62,17 @@
 /**************************************************************************************/
 
 
+/* Timeouts of the ready flags, the max start up times of the datasheet with a margin:
+ * HSI:		tsu(HSI) is 4 us max.
+ * HSE:		tsu(HSE) is 2 ms typical with a crystal, it depends on the crystal and its load
+ * 			capacitors so it's given 50 times as much.
+ * PLLs:	tLOCK is 300 us max. */
+#define RCC_HSI_TIMEOUT_US				(10UL)
+#define RCC_HSE_TIMEOUT_US				(100000UL)
+#define RCC_PLL_TIMEOUT_US				(500UL)
+/**************************************************************************************/
+
+
 
 /* RCC_PLLCFGR's Bits offset */
 
@@ -193,6 +205,51 @@ static volatile RCC_strRegsiters_t* const RCC = ((RCC_strRegsiters_t*)(RCC_BASE_
 /********************************************************************************************/
 
 
+/**
+ *@brief : Function to calculate the core clock (HCLK) from the selected system clock source, the PLL
+ * 			factors and the AHB pre-scaler, the DWT delays and deadlines are converted with it.
+ *@param : void.
+ *@return: The core clock in Hz.
+ */
+static uint32_t RCC_u32GetHCLK(void)
+{
+	/* The AHB pre-scaler of each value of the HPRE bits, the values below 8 don't divide */
+	static const uint16_t LOC_arru16AHBPrescalers [8] = {2, 4, 8, 16, 64, 128, 256, 512};
+	uint32_t LOC_u32SysClk;
+	uint32_t LOC_u32PLLInput;
+	uint32_t LOC_u32HPRE;
+
+	switch (RCC->CFGR & SW_SETMASK)
+	{
+	case SYSCLK_HSE:
+		LOC_u32SysClk = HSE_CRYSTAL_VALUE;
+		break;
+	case SYSCLK_PLL:
+		LOC_u32PLLInput = (RCC->PLLCFGR & PLLSRC_SETMASK) ? HSE_CRYSTAL_VALUE : HSI_VALUE;
+		/* PLLCLK = input / PLLM * PLLN / PLLP, PLLP is 2, 4, 6 or 8 */
+		LOC_u32SysClk = (LOC_u32PLLInput / ((RCC->PLLCFGR & PLLM_SETMASK) >> RCC_PLLCFGR_PLLM))
+						* ((RCC->PLLCFGR & PLLN_SETMASK) >> RCC_PLLCFGR_PLLN)
+						/ ((((RCC->PLLCFGR & PLLP_SETMASK) >> RCC_PLLCFGR_PLLP) + 1) * 2);
+		break;
+	default:
+		LOC_u32SysClk = HSI_VALUE;
+		break;
+	}
+
+	LOC_u32HPRE = (RCC->CFGR & AHBPRES_SETMASK) >> 4;
+	if (LOC_u32HPRE >= 8)
+	{
+		LOC_u32SysClk /= LOC_arru16AHBPrescalers[LOC_u32HPRE - 8];
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	return LOC_u32SysClk;
+}
+
+
 
 /********************************************************************************************/
 /*									Functions' Implementation								*/
@@ -208,14 +265,15 @@ RCC_enuErrorStatus_t RCC_enuEnableHSI(void)
 	RCC_enuErrorStatus_t LOC_enuErrorStatus = RCC_enuOk;
 
 	/* Used for timeout mechanism */
-	uint32_t LOC_u32Counter = 1000;
+	DWT_strDeadline_t LOC_strDeadline;
 
 	/* Set HSI ON */
 	RCC->CR |= HSION;
 	/* loop till the ready flag is set or when reach a timeout */
-	while ((!(RCC->CR & HSIRDY)) && (LOC_u32Counter > 0))
+	DWT_vStartDeadline(&LOC_strDeadline, RCC_HSI_TIMEOUT_US);
+	while ((!(RCC->CR & HSIRDY)) && (DWT_u8IsDeadlinePassed(&LOC_strDeadline) == 0))
 	{
-		LOC_u32Counter--;
+		/* Wait */
 	}
 
 	/* Check if the code got out from the loop because the flag is set or not */
@@ -243,14 +301,15 @@ RCC_enuErrorStatus_t RCC_enuDisableHSI(void)
 	RCC_enuErrorStatus_t LOC_enuErrorStatus = RCC_enuOk;
 
 	/* Used for timeout mechanism */
-	uint32_t LOC_u32Counter = 1000;
+	DWT_strDeadline_t LOC_strDeadline;
 
 	/* Set HSI OFF */
 	RCC->CR &= ~(HSION);
 	/* loop till the ready flag is cleared or when reach a timeout */
-	while ((RCC->CR & HSIRDY) && (LOC_u32Counter > 0))
+	DWT_vStartDeadline(&LOC_strDeadline, RCC_HSI_TIMEOUT_US);
+	while ((RCC->CR & HSIRDY) && (DWT_u8IsDeadlinePassed(&LOC_strDeadline) == 0))
 	{
-		LOC_u32Counter--;
+		/* Wait */
 	}
 
 	/* Check if the code got out from the loop because the flag is cleared or not */
@@ -278,14 +337,15 @@ RCC_enuErrorStatus_t RCC_enuEnableHSECrystal(void)
 	RCC_enuErrorStatus_t LOC_enuErrorStatus = RCC_enuOk;
 
 	/* Used for timeout mechanism */
-	uint32_t LOC_u32Counter = 1000;
+	DWT_strDeadline_t LOC_strDeadline;
 
 	/* Set HSE ON */
 	RCC->CR |= HSEON;
 	/* loop till the ready flag is set or when reach a timeout */
-	while ((!(RCC->CR & HSERDY)) && (LOC_u32Counter > 0))
+	DWT_vStartDeadline(&LOC_strDeadline, RCC_HSE_TIMEOUT_US);
+	while ((!(RCC->CR & HSERDY)) && (DWT_u8IsDeadlinePassed(&LOC_strDeadline) == 0))
 	{
-		LOC_u32Counter--;
+		/* Wait */
 	}
 
 	/* Check if the code got out from the loop because the flag is set or not */
@@ -313,14 +373,15 @@ RCC_enuErrorStatus_t RCC_enuDisableHSECrystal(void)
 	RCC_enuErrorStatus_t LOC_enuErrorStatus = RCC_enuOk;
 
 	/* Used for timeout mechanism */
-	uint32_t LOC_u32Counter = 1000;
+	DWT_strDeadline_t LOC_strDeadline;
 
 	/* Set HSE OFF */
 	RCC->CR &= ~(HSEON);
 	/* loop till the ready flag is cleared or when reach a timeout */
-	while ((RCC->CR & HSERDY) && (LOC_u32Counter > 0))
+	DWT_vStartDeadline(&LOC_strDeadline, RCC_HSE_TIMEOUT_US);
+	while ((RCC->CR & HSERDY) && (DWT_u8IsDeadlinePassed(&LOC_strDeadline) == 0))
 	{
-		LOC_u32Counter--;
+		/* Wait */
 	}
 
 	/* Check if the code got out from the loop because the flag is cleared or not */
@@ -357,7 +418,7 @@ RCC_enuErrorStatus_t RCC_enuEnableHSEBYP(void)
 		/* Now We can enable bypass mode as the HSE is not ON (not enabled) */
 
 		/* Used for timeout mechanism */
-		uint32_t LOC_u32Counter = 1000;
+		DWT_strDeadline_t LOC_strDeadline;
 
 		/* Set HSEBYP ON */
 		RCC->CR |= HSEBYP;
@@ -366,9 +427,10 @@ RCC_enuErrorStatus_t RCC_enuEnableHSEBYP(void)
 		RCC->CR |= HSEON;
 
 		/* loop till the ready flag is set or when reach a timeout */
-		while ((!(RCC->CR & HSERDY)) && (LOC_u32Counter > 0))
+		DWT_vStartDeadline(&LOC_strDeadline, RCC_HSE_TIMEOUT_US);
+		while ((!(RCC->CR & HSERDY)) && (DWT_u8IsDeadlinePassed(&LOC_strDeadline) == 0))
 		{
-			LOC_u32Counter--;
+			/* Wait */
 		}
 
 		/* Check if the code got out from the loop because the flag is set or not */
@@ -397,14 +459,15 @@ RCC_enuErrorStatus_t RCC_enuDisableHSEBYP(void)
 	RCC_enuErrorStatus_t LOC_enuErrorStatus = RCC_enuOk;
 
 	/* Used for timeout mechanism */
-	uint32_t LOC_u32Counter = 1000;
+	DWT_strDeadline_t LOC_strDeadline;
 
 	/* Set HSE OFF */
 	RCC->CR &= ~(HSEON);
 	/* loop till the ready flag is cleared or when reach a timeout */
-	while ((RCC->CR & HSERDY) && (LOC_u32Counter > 0))
+	DWT_vStartDeadline(&LOC_strDeadline, RCC_HSE_TIMEOUT_US);
+	while ((RCC->CR & HSERDY) && (DWT_u8IsDeadlinePassed(&LOC_strDeadline) == 0))
 	{
-		LOC_u32Counter--;
+		/* Wait */
 	}
 
 	/* Check if the code got out from the loop because the flag is cleared or not */
@@ -435,14 +498,15 @@ RCC_enuErrorStatus_t RCC_enuEnableMainPLL(void)
 	RCC_enuErrorStatus_t LOC_enuErrorStatus = RCC_enuOk;
 
 	/* Used for timeout mechanism */
-	uint32_t LOC_u32Counter = 1000;
+	DWT_strDeadline_t LOC_strDeadline;
 
 	/* Set PLL ON */
 	RCC->CR |= PLLON;
 	/* loop till the ready flag is set or when reach a timeout */
-	while ((!(RCC->CR & PLLRDY)) && (LOC_u32Counter > 0))
+	DWT_vStartDeadline(&LOC_strDeadline, RCC_PLL_TIMEOUT_US);
+	while ((!(RCC->CR & PLLRDY)) && (DWT_u8IsDeadlinePassed(&LOC_strDeadline) == 0))
 	{
-		LOC_u32Counter--;
+		/* Wait */
 	}
 
 	/* Check if the code got out from the loop because the flag is set or not */
@@ -470,14 +534,15 @@ RCC_enuErrorStatus_t RCC_enuDisableMainPLL(void)
 	RCC_enuErrorStatus_t LOC_enuErrorStatus = RCC_enuOk;
 
 	/* Used for timeout mechanism */
-	uint32_t LOC_u32Counter = 1000;
+	DWT_strDeadline_t LOC_strDeadline;
 
 	/* Set PLL OFF */
 	RCC->CR &= ~(PLLON);
 	/* loop till the ready flag is cleared or when reach a timeout */
-	while ((RCC->CR & PLLRDY) && (LOC_u32Counter > 0))
+	DWT_vStartDeadline(&LOC_strDeadline, RCC_PLL_TIMEOUT_US);
+	while ((RCC->CR & PLLRDY) && (DWT_u8IsDeadlinePassed(&LOC_strDeadline) == 0))
 	{
-		LOC_u32Counter--;
+		/* Wait */
 	}
 
 	/* Check if the code got out from the loop because the flag is cleared or not */
@@ -505,14 +570,15 @@ RCC_enuErrorStatus_t RCC_enuEnablePLLI2S(void)
 	RCC_enuErrorStatus_t LOC_enuErrorStatus = RCC_enuOk;
 
 	/* Used for timeout mechanism */
-	uint32_t LOC_u32Counter = 1000;
+	DWT_strDeadline_t LOC_strDeadline;
 
 	/* Set PLLI2S ON */
 	RCC->CR |= PLLI2SON;
 	/* loop till the ready flag is set or when reach a timeout */
-	while ((!(RCC->CR & PLLI2SRDY)) && (LOC_u32Counter > 0))
+	DWT_vStartDeadline(&LOC_strDeadline, RCC_PLL_TIMEOUT_US);
+	while ((!(RCC->CR & PLLI2SRDY)) && (DWT_u8IsDeadlinePassed(&LOC_strDeadline) == 0))
 	{
-		LOC_u32Counter--;
+		/* Wait */
 	}
 
 	/* Check if the code got out from the loop because the flag is set or not */
@@ -541,14 +607,15 @@ RCC_enuErrorStatus_t RCC_enuDisablePLLI2S(void)
 	RCC_enuErrorStatus_t LOC_enuErrorStatus = RCC_enuOk;
 
 	/* Used for timeout mechanism */
-	uint32_t LOC_u32Counter = 1000;
+	DWT_strDeadline_t LOC_strDeadline;
 
 	/* Set PLLI2S OFF */
 	RCC->CR &= ~(PLLI2SON);
 	/* loop till the ready flag is cleared or when reach a timeout */
-	while ((RCC->CR & PLLI2SRDY) && (LOC_u32Counter > 0))
+	DWT_vStartDeadline(&LOC_strDeadline, RCC_PLL_TIMEOUT_US);
+	while ((RCC->CR & PLLI2SRDY) && (DWT_u8IsDeadlinePassed(&LOC_strDeadline) == 0))
 	{
-		LOC_u32Counter--;
+		/* Wait */
 	}
 
 	/* Check if the code got out from the loop because the flag is cleared or not */
@@ -1054,6 +1121,9 @@ RCC_enuErrorStatus_t RCC_enuSelectSysClk(uint32_t Copy_u32SysClk)
 		/* As We finish the configurations, We can assign directly in the
 		 * real register */
 		RCC->CFGR = LOC_u32LocalReg;
+
+		/* The delays of the DWT follow the new core clock */
+		DWT_enuSetCoreClock(RCC_u32GetHCLK());
 	}
 	else
 	{
@@ -1342,6 +1412,9 @@ RCC_enuErrorStatus_t RCC_enuConfigAHBPRES(uint32_t Copy_u32AHBPRES)
 		/* As We finish the configurations, We can assign directly in the
 		 * real register */
 		RCC->CFGR = LOC_u32LocalReg;
+
+		/* The delays of the DWT follow the new core clock */
+		DWT_enuSetCoreClock(RCC_u32GetHCLK());
 	}
 	else
 	{
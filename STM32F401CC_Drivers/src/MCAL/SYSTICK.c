@@ -20,6 +20,7 @@
 
 
 #include <MCAL/SYSTICK.h>
+#include <LIB/cpu_intrinsics.h>
 
 
 
@@ -49,6 +50,27 @@
 /* Max value for the SysTick ticks */
 #define MAX_SYSTICK_VALUE						(0x00FFFFFFUL)
 
+/* The address of the Interrupt Control and State Register (ICSR) of the SCB */
+#define SCB_ICSR_ADDRESS						(0xE000ED04UL)
+/* ICSR PENDSTSET bit set mask, it's read as one while the SysTick exception is pending */
+#define SCB_ICSR_PENDSTSET_SET_MASK				(0x04000000UL)
+
+/* GLB_TimeSequence is odd from the start of the handler until it counts the ended period, and the copy of
+ * the time base in use is the second bit */
+#define SYSTICK_SEQUENCE_ENDED_MASK				(0x00000001UL)
+#define SYSTICK_SEQUENCE_COPY(Sequence)			(((Sequence) >> 1) & 1UL)
+
+/* Core clock cycles of one count of the SysTick with its selected clock source */
+#define SYSTICK_CYCLES_PER_COUNT()				(((SYSTICK->STK_CTRL & STK_CTRL_CLKSOURCE_AHB_SET_MASK) != 0) ? 1UL : 8UL)
+
+/* Check if the user entered an invalid number of subscribers */
+#if ((SYSTICK_SUBSCRIBERS_NUMBER < 1) || (SYSTICK_SUBSCRIBERS_NUMBER > 16))
+#error "INVALID SYSTICK_SUBSCRIBERS_NUMBER is selected :(\nIt must be from 1 up to 16"
+#endif
+
+/* The priority of the call back set by SYSTICK_SetCallBack, the highest one */
+#define SYSTICK_CALLBACK_PRIORITY				(0)
+
 
 /****************************************************************************************/
 /*								User-defined types Declaration							*/
@@ -62,6 +84,25 @@ typedef struct {
 	volatile uint32_t STK_CALIB;
 }SYSTICK_strRegsiters_t;
 
+/* The time counted by the SysTick handler until the start of the running period */
+typedef struct {
+	/* Core clock cycles counted before the running period */
+	uint64_t periodStartCycles;
+	/* The STK_LOAD value the running period counts down from */
+	uint32_t periodLoad;
+	/* Core clock cycles of one count in the running period */
+	uint32_t cyclesPerCount;
+}SYSTICK_strTimeBase_t;
+
+/* A subscriber of the SysTick interrupt */
+typedef struct {
+	sysTickCBF_t callBackFn;
+	/* It runs once every "divider" interrupts, when "countdown" reaches zero */
+	uint32_t divider;
+	uint32_t countdown;
+	uint8_t priority;
+}SYSTICK_strSubscriber_t;
+
 
 
 /****************************************************************************************/
@@ -75,6 +116,22 @@ static SYSTICK_strRegsiters_t* const SYSTICK = (SYSTICK_strRegsiters_t*)(SYSTICK
 
 static uint32_t GLB_StartType = 0;
 
+static volatile uint32_t* const SCB_ICSR = (volatile uint32_t*)(SCB_ICSR_ADDRESS);
+
+/* Two copies of the time base, the SysTick handler writes the one that isn't in use then moves
+ * GLB_TimeSequence to it, so a reader that interrupts the handler still reads a whole copy, and a
+ * reader that is interrupted by the handler sees GLB_TimeSequence change and reads again */
+static volatile SYSTICK_strTimeBase_t GLB_TimeBases[2];
+static volatile uint32_t GLB_TimeSequence = 0;
+
+/* The subscribers sorted by their priorities, the handler visits the first GLB_SubscribersNumber only */
+static SYSTICK_strSubscriber_t GLB_Subscribers[SYSTICK_SUBSCRIBERS_NUMBER];
+static volatile uint32_t GLB_SubscribersNumber = 0;
+
+/* Core clock cycles spent in the last run of the handler and in the longest one */
+static volatile uint32_t GLB_HandlerCycles = 0;
+static volatile uint32_t GLB_MaxHandlerCycles = 0;
+
 
 
 /****************************************************************************************/
@@ -82,6 +139,24 @@ static uint32_t GLB_StartType = 0;
 /****************************************************************************************/
 
 
+/**
+ *@brief : Function to start a new copy of the time base, the running period starts from the given time.
+ *@param : Core clock cycles counted before the running period.
+ *@return: void.
+ */
+static void SYSTICK_StartTimeBase(uint64_t PeriodStartCycles)
+{
+	uint32_t LOC_u32Sequence = GLB_TimeSequence;
+	volatile SYSTICK_strTimeBase_t* LOC_pstrNext = &GLB_TimeBases[SYSTICK_SEQUENCE_COPY(LOC_u32Sequence) ^ 1UL];
+
+	LOC_pstrNext->periodStartCycles = PeriodStartCycles;
+	LOC_pstrNext->periodLoad = SYSTICK->STK_LOAD & MAX_SYSTICK_VALUE;
+	LOC_pstrNext->cyclesPerCount = SYSTICK_CYCLES_PER_COUNT();
+
+	/* The copy is complete, the readers can use it now. The next even sequence points at it, and tells that
+	 * the ended period (if any) is counted */
+	GLB_TimeSequence = (LOC_u32Sequence | SYSTICK_SEQUENCE_ENDED_MASK) + 1;
+}
 
 
 
@@ -117,6 +192,12 @@ SYSTICK_enuErrorStatus_t SYSTICK_Start(uint32_t start_)
 
 		/* Configure the SysTick correctly */
 
+		/* The time goes on from where it stopped, the first period counts down from the loaded value */
+		SYSTICK_StartTimeBase(SYSTICK_GetCycles());
+
+		/* Clear the current value (any write clears it) so the first period is a complete one */
+		SYSTICK->STK_VAL = 0;
+
 		/* Create a local variable as an image of the real register */
 		uint32_t LOC_u32LocalReg = SYSTICK->STK_CTRL;
 		/* Clean the bits before assigning in it */
@@ -231,7 +312,8 @@ SYSTICK_enuErrorStatus_t SYSTICK_SetTimeMilliSec(uint32_t DelayTime)
 
 
 /**
- *@brief : Function to set the call back function that the user entered.
+ *@brief : Function to set the call back function that the user entered, it's a subscriber of priority 0
+ * 			that runs every tick and replaces the one set before by this function.
  *@param : pointer to function that takes a void and returns void.
  *@return: Error status.
  */
@@ -249,19 +331,252 @@ SYSTICK_enuErrorStatus_t SYSTICK_SetCallBack(sysTickCBF_t LOC_CallBackFunction)
 	{
 		/* Seems that the user entered a pointer that can be accessed */
 
-		/* Assign the entered pointer to function to a global pointer that will be called in the
-		 * SysTick handler */
-		GLB_CallBackFunction = LOC_CallBackFunction;
+		/* Replace the call back set before by a subscriber that runs every tick before the others */
+		if (GLB_CallBackFunction != NULL_PTR)
+		{
+			SYSTICK_Unsubscribe(GLB_CallBackFunction);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+		LOC_enuErrorStatus = SYSTICK_Subscribe(LOC_CallBackFunction, 1, SYSTICK_CALLBACK_PRIORITY);
+		GLB_CallBackFunction = (LOC_enuErrorStatus == SYSTICK_enuOk) ? LOC_CallBackFunction : NULL_PTR;
+	}
+
+	return LOC_enuErrorStatus;
+}
+
+
+/**
+ *@brief : Function to add a call back to the subscribers of the SysTick interrupt. The handler runs the
+ * 			subscribers in the order of their priorities (0 first, the same priority in the order they
+ * 			subscribed), each one once every "Divider" interrupts starting "Divider" interrupts from now.
+ * 			It must not be called from a subscriber.
+ *@param : The call back, the divider (from 1 up) and the priority (0 is the highest).
+ *@return: Error status.
+ */
+SYSTICK_enuErrorStatus_t SYSTICK_Subscribe(sysTickCBF_t CallBackFunction, uint32_t Divider, uint8_t Priority)
+{
+	SYSTICK_enuErrorStatus_t LOC_enuErrorStatus = SYSTICK_enuOk;
+	uint32_t LOC_u32Index;
+	uint32_t LOC_u32Mask;
+
+	if (CallBackFunction == NULL_PTR)
+	{
+		LOC_enuErrorStatus = SYSTICK_enuNullPointer;
+	}
+	else if (Divider == 0)
+	{
+		LOC_enuErrorStatus = SYSTICK_enuInvalidDivider;
+	}
+	else
+	{
+		/* The handler must not see the table while it's being shifted */
+		LOC_u32Mask = CPU_SaveAndDisableInterrupts();
+		if (GLB_SubscribersNumber >= SYSTICK_SUBSCRIBERS_NUMBER)
+		{
+			LOC_enuErrorStatus = SYSTICK_enuSubscribersFull;
+		}
+		else
+		{
+			/* Shift the lower priorities down to keep the table sorted, so the handler just walks it */
+			LOC_u32Index = GLB_SubscribersNumber;
+			while ((LOC_u32Index > 0) && (GLB_Subscribers[LOC_u32Index - 1].priority > Priority))
+			{
+				GLB_Subscribers[LOC_u32Index] = GLB_Subscribers[LOC_u32Index - 1];
+				LOC_u32Index--;
+			}
+			GLB_Subscribers[LOC_u32Index].callBackFn = CallBackFunction;
+			GLB_Subscribers[LOC_u32Index].divider = Divider;
+			GLB_Subscribers[LOC_u32Index].countdown = Divider;
+			GLB_Subscribers[LOC_u32Index].priority = Priority;
+			GLB_SubscribersNumber++;
+		}
+		CPU_RestoreInterrupts(LOC_u32Mask);
 	}
 
 	return LOC_enuErrorStatus;
 }
 
 
+/**
+ *@brief : Function to remove a call back from the subscribers of the SysTick interrupt. It must not be
+ * 			called from a subscriber.
+ *@param : The call back.
+ *@return: Error status, SYSTICK_enuNotOk if it isn't subscribed.
+ */
+SYSTICK_enuErrorStatus_t SYSTICK_Unsubscribe(sysTickCBF_t CallBackFunction)
+{
+	SYSTICK_enuErrorStatus_t LOC_enuErrorStatus = SYSTICK_enuNotOk;
+	uint32_t LOC_u32Index;
+	uint32_t LOC_u32Mask;
+
+	if (CallBackFunction == NULL_PTR)
+	{
+		LOC_enuErrorStatus = SYSTICK_enuNullPointer;
+	}
+	else
+	{
+		LOC_u32Mask = CPU_SaveAndDisableInterrupts();
+		for (LOC_u32Index = 0; LOC_u32Index < GLB_SubscribersNumber; LOC_u32Index++)
+		{
+			if (LOC_enuErrorStatus == SYSTICK_enuOk)
+			{
+				/* Shift the ones after the removed subscriber up */
+				GLB_Subscribers[LOC_u32Index - 1] = GLB_Subscribers[LOC_u32Index];
+			}
+			else if (GLB_Subscribers[LOC_u32Index].callBackFn == CallBackFunction)
+			{
+				LOC_enuErrorStatus = SYSTICK_enuOk;
+			}
+			else
+			{
+				/* Do Nothing */
+			}
+		}
+		if (LOC_enuErrorStatus == SYSTICK_enuOk)
+		{
+			GLB_SubscribersNumber--;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+		CPU_RestoreInterrupts(LOC_u32Mask);
+	}
+
+	return LOC_enuErrorStatus;
+}
+
+
+/**
+ *@brief : Function to get the time spent in the SysTick handler with all its subscribers, from the
+ * 			interrupt to the end of the last subscriber, measured by the SysTick itself (in units of its
+ * 			clock, 1 or 8 core cycles). It's measured in periodic mode only and it must be shorter than a
+ * 			period.
+ *@param : Addresses to return the time of the last interrupt and the longest one in core clock cycles.
+ *@return: Error status.
+ */
+SYSTICK_enuErrorStatus_t SYSTICK_GetHandlerCycles(uint32_t* LastCycles, uint32_t* MaxCycles)
+{
+	SYSTICK_enuErrorStatus_t LOC_enuErrorStatus = SYSTICK_enuOk;
+
+	if ((LastCycles == NULL_PTR) || (MaxCycles == NULL_PTR))
+	{
+		LOC_enuErrorStatus = SYSTICK_enuNullPointer;
+	}
+	else
+	{
+		*LastCycles = GLB_HandlerCycles;
+		*MaxCycles = GLB_MaxHandlerCycles;
+	}
+
+	return LOC_enuErrorStatus;
+}
+
+
+
+
+/**
+ *@brief : Function to get the time counted by the SysTick since the first start in core clock cycles,
+ * 			it doesn't count while the SysTick is stopped. It never masks the interrupts: it reads again if
+ * 			the SysTick handler counts a period meanwhile, and counts the ended period by itself if the
+ * 			handler is still pending, or is running (interrupted by the caller) and hasn't counted it yet.
+ * 			It's safe to call from any interrupt as long as the handler isn't delayed for a whole period,
+ * 			and the SysTick isn't written (STK_LOAD, STK_CTRL) between the end of a period and the handler.
+ * 			An interrupt above the SysTick that comes in the first instructions of the handler, before it
+ * 			marks the period as ended, reads the time one period behind.
+ *@param : void.
+ *@return: The time in core clock cycles, it never wraps around.
+ */
+uint64_t SYSTICK_GetCycles(void)
+{
+	uint32_t LOC_u32Sequence;
+	uint32_t LOC_u32Value;
+	uint32_t LOC_u32Load;
+	uint32_t LOC_u32CyclesPerCount;
+	uint32_t LOC_u32Ended;
+	uint64_t LOC_u64Cycles;
+
+	do
+	{
+		LOC_u32Sequence = GLB_TimeSequence;
+		LOC_u64Cycles = GLB_TimeBases[SYSTICK_SEQUENCE_COPY(LOC_u32Sequence)].periodStartCycles;
+		LOC_u32Load = GLB_TimeBases[SYSTICK_SEQUENCE_COPY(LOC_u32Sequence)].periodLoad;
+		LOC_u32CyclesPerCount = GLB_TimeBases[SYSTICK_SEQUENCE_COPY(LOC_u32Sequence)].cyclesPerCount;
+
+		/* The exception is pended when the counter gets to zero, so if it's not pending after reading
+		 * the counter, the value belongs to the running period. Once the handler is active the pending
+		 * bit is cleared, the odd sequence tells that it hasn't counted the period yet */
+		LOC_u32Value = SYSTICK->STK_VAL;
+		LOC_u32Ended = ((*SCB_ICSR) & SCB_ICSR_PENDSTSET_SET_MASK) | (LOC_u32Sequence & SYSTICK_SEQUENCE_ENDED_MASK);
+
+		if (LOC_u32Ended == 0)
+		{
+			/* Zero here is the first count after SYSTICK_Start, nothing of the period is passed yet, and
+			 * before the first start the counter isn't counting from "periodLoad" at all */
+			if ((LOC_u32Value != 0) && (LOC_u32Value <= LOC_u32Load))
+			{
+				LOC_u64Cycles += (uint64_t)(LOC_u32Load - LOC_u32Value) * LOC_u32CyclesPerCount;
+			}
+			else
+			{
+				/* Do Nothing */
+			}
+		}
+		else
+		{
+			/* The period has ended and the handler hasn't counted it yet, read the counter again as
+			 * it may have been reloaded after the first read */
+			LOC_u32Value = SYSTICK->STK_VAL;
+			if (LOC_u32Value == 0)
+			{
+				LOC_u64Cycles += (uint64_t)LOC_u32Load * LOC_u32CyclesPerCount;
+			}
+			else
+			{
+				LOC_u64Cycles += ((uint64_t)(LOC_u32Load + 1) * LOC_u32CyclesPerCount) +
+						((uint64_t)((SYSTICK->STK_LOAD & MAX_SYSTICK_VALUE) - LOC_u32Value) * LOC_u32CyclesPerCount);
+			}
+		}
+	} while (LOC_u32Sequence != GLB_TimeSequence);
+
+	return LOC_u64Cycles;
+}
+
+
+/**
+ *@brief : Function to get the time counted by the SysTick since the first start in microseconds, the same
+ * 			as SYSTICK_GetCycles.
+ *@param : void.
+ *@return: The time in microseconds, it never wraps around.
+ */
+uint64_t SYSTICK_GetTimeUs(void)
+{
+	return SYSTICK_GetCycles() / (AHB_CLOCK_SOURCE_VALUE / NUM_OF_US_IN_1_SEC);
+}
+
+
 
 
 void SysTick_Handler (void)
 {
+	volatile SYSTICK_strTimeBase_t* LOC_pstrRunning;
+	SYSTICK_strSubscriber_t* LOC_pstrSubscriber;
+	uint32_t LOC_u32Index;
+	uint32_t LOC_u32Value;
+
+	/* The pending bit is cleared already, tell the readers that interrupt the handler that the period has
+	 * ended and isn't counted yet, the copy in use stays the same */
+	GLB_TimeSequence |= SYSTICK_SEQUENCE_ENDED_MASK;
+
+	/* Count the period that has just ended before anything else, so the call back reads the new time.
+	 * The counter has already been reloaded, STK_LOAD is the value of the new period */
+	LOC_pstrRunning = &GLB_TimeBases[SYSTICK_SEQUENCE_COPY(GLB_TimeSequence)];
+	SYSTICK_StartTimeBase(LOC_pstrRunning->periodStartCycles +
+			((uint64_t)(LOC_pstrRunning->periodLoad + 1) * LOC_pstrRunning->cyclesPerCount));
+
 	/* Check first on the start type */
 	if(GLB_StartType == START_ONE_TIME)
 	{
@@ -275,14 +590,47 @@ void SysTick_Handler (void)
 		/* Do Nothing */
 	}
 
-	/* Check that the global pointer to function is assigned and not a NULL pointer */
-	if (GLB_CallBackFunction != NULL_PTR)
+	/* One compare per subscriber, the ones whose turn hasn't come cost a decrement only */
+	for (LOC_u32Index = 0; LOC_u32Index < GLB_SubscribersNumber; LOC_u32Index++)
 	{
-		/* Now we need to call the CBF that was entered by the user */
-		GLB_CallBackFunction();
+		LOC_pstrSubscriber = &GLB_Subscribers[LOC_u32Index];
+		if (--LOC_pstrSubscriber->countdown == 0)
+		{
+			LOC_pstrSubscriber->countdown = LOC_pstrSubscriber->divider;
+			LOC_pstrSubscriber->callBackFn();
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+
+	/* The counter was reloaded with the load of the new period when the interrupt came, what it counted
+	 * down since then is the time of the handler. A stopped SysTick (one time mode or stopped by a
+	 * subscriber) doesn't count */
+	if (SYSTICK->STK_CTRL & STK_CTRL_ENABLE_SET_MASK)
+	{
+		LOC_pstrRunning = &GLB_TimeBases[SYSTICK_SEQUENCE_COPY(GLB_TimeSequence)];
+		LOC_u32Value = SYSTICK->STK_VAL;
+		if (LOC_u32Value <= LOC_pstrRunning->periodLoad)
+		{
+			GLB_HandlerCycles = (LOC_pstrRunning->periodLoad - LOC_u32Value) * LOC_pstrRunning->cyclesPerCount;
+			if (GLB_HandlerCycles > GLB_MaxHandlerCycles)
+			{
+				GLB_MaxHandlerCycles = GLB_HandlerCycles;
+			}
+			else
+			{
+				/* Do Nothing */
+			}
+		}
+		else
+		{
+			/* Do Nothing */
+		}
 	}
 	else
 	{
-		/* Do Nothing, (I think the could shouldn't reach this line) */
+		/* Do Nothing */
 	}
 }
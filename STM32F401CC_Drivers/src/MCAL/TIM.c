@@ -0,0 +1,308 @@
+/******************************************************************************
+*
+* Module: TIM Driver
+*
+* File Name: TIM.c
+*
+* Description: Driver's APIs' Implementation and typedefs' declaration.
+*
+* Author: Shaher Shah Abdalla Kamal
+*
+* Date: 17-10-2026
+*
+*******************************************************************************/
+
+
+
+/****************************************************************************************/
+/*										Includes										*/
+/****************************************************************************************/
+
+#include <MCAL/TIM.h>
+#include <MCAL/RCC.h>
+#include <LIB/bitband.h>
+
+
+
+/****************************************************************************************/
+/*									Macros Declaration									*/
+/****************************************************************************************/
+
+
+/* TIMx_CR1 CEN bit number, it enables the counter, it's set and cleared through its bit-band alias */
+#define TIM_CR1_CEN_BIT							(0UL)
+/* TIMx_CR1 URS bit set mask, only an overflow of the counter generates the update interrupt */
+#define TIM_CR1_URS_SET_MASK					(0x00000004UL)
+/* TIMx_CR1 ARPE bit set mask, TIMx_ARR is buffered until the next update */
+#define TIM_CR1_ARPE_SET_MASK					(0x00000080UL)
+/* TIMx_DIER UIE bit set mask, it enables the update interrupt */
+#define TIM_DIER_UIE_SET_MASK					(0x00000001UL)
+/* TIMx_SR UIF bit set mask, the update interrupt flag */
+#define TIM_SR_UIF_SET_MASK						(0x00000001UL)
+/* TIMx_EGR UG bit set mask, it clears the counter and loads the buffered registers */
+#define TIM_EGR_UG_SET_MASK						(0x00000001UL)
+
+/* Number of microseconds in one second */
+#define NUM_OF_US_IN_1_SEC						(1000000UL)
+
+/* The pre-scaler that makes the counter count microseconds (the timer divides by TIMx_PSC + 1) */
+#define TIM_PSC_VALUE							((TIM_CLOCK_SOURCE_VALUE / NUM_OF_US_IN_1_SEC) - 1)
+
+/* Index of each timer in the call backs array */
+#define TIM_TIMER2_INDEX						(0)
+#define TIM_TIMER5_INDEX						(1)
+#define TIM_TIMERS_NUMBER						(2)
+
+
+/* Check first if the user entered an invalid timers' clock */
+#if ((TIM_CLOCK_SOURCE_VALUE < NUM_OF_US_IN_1_SEC) || ((TIM_CLOCK_SOURCE_VALUE % NUM_OF_US_IN_1_SEC) != 0))
+#error "INVALID TIM_CLOCK_SOURCE_VALUE is selected :(\nIt must be a multiple of 1 MHz"
+#endif
+
+
+
+/****************************************************************************************/
+/*								User-defined types Declaration							*/
+/****************************************************************************************/
+
+
+typedef struct {
+	volatile uint32_t TIM_CR1;
+	volatile uint32_t TIM_CR2;
+	volatile uint32_t TIM_SMCR;
+	volatile uint32_t TIM_DIER;
+	volatile uint32_t TIM_SR;
+	volatile uint32_t TIM_EGR;
+	volatile uint32_t TIM_CCMR1;
+	volatile uint32_t TIM_CCMR2;
+	volatile uint32_t TIM_CCER;
+	volatile uint32_t TIM_CNT;
+	volatile uint32_t TIM_PSC;
+	volatile uint32_t TIM_ARR;
+}TIM_strRegsiters_t;
+
+
+
+/****************************************************************************************/
+/*									Variables's Declaration								*/
+/****************************************************************************************/
+
+
+static timCBF_t GLB_CallBackFunctions [TIM_TIMERS_NUMBER] = {NULL_PTR, NULL_PTR};
+
+
+
+/****************************************************************************************/
+/*								Static Functions' Declaration							*/
+/****************************************************************************************/
+
+
+/**
+ *@brief : Function that calls the call back of a timer after clearing its update flag.
+ *@param : The timer's base address.
+ *@param : Index of the timer in the call backs array.
+ *@return: void.
+ */
+static inline void TIM_handleUpdate(uint32_t Copy_u32Timer, uint32_t Copy_u32Index)
+{
+	TIM_strRegsiters_t* LOC_pstrTimer = (TIM_strRegsiters_t*)Copy_u32Timer;
+
+	/* The flag is cleared by writing zero, writing one to the other flags doesn't change them */
+	LOC_pstrTimer->TIM_SR = ~(TIM_SR_UIF_SET_MASK);
+
+	if (GLB_CallBackFunctions[Copy_u32Index] != NULL_PTR)
+	{
+		GLB_CallBackFunctions[Copy_u32Index]();
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+
+
+/****************************************************************************************/
+/*								Functions' Implementation								*/
+/****************************************************************************************/
+
+
+/**
+ *@brief : Function to enable the clock of a timer and configure it to count microseconds up, with
+ * 			its period buffered (a new period is used from the next update) and its update interrupt
+ * 			enabled. The IRQ (IRQ_TIM2 or IRQ_TIM5) still needs to be enabled in the NVIC.
+ *@param : The timer (TIM_TIMER2 or TIM_TIMER5).
+ *@return: Error status.
+ */
+TIM_enuErrorStatus_t TIM_enuInit(uint32_t Copy_u32Timer)
+{
+	TIM_enuErrorStatus_t LOC_enuErrorStatus = TIM_enuOk;
+	TIM_strRegsiters_t* LOC_pstrTimer = (TIM_strRegsiters_t*)Copy_u32Timer;
+
+	if ((Copy_u32Timer != TIM_TIMER2) && (Copy_u32Timer != TIM_TIMER5))
+	{
+		LOC_enuErrorStatus = TIM_enuInvalidTimer;
+	}
+	else
+	{
+		RCC_enuEnableAPB1Peripheral((Copy_u32Timer == TIM_TIMER2) ? APB1_TIM2 : APB1_TIM5);
+
+		/* Stop the counter while configuring it */
+		LOC_pstrTimer->TIM_CR1 = TIM_CR1_ARPE_SET_MASK | TIM_CR1_URS_SET_MASK;
+		LOC_pstrTimer->TIM_PSC = TIM_PSC_VALUE;
+
+		/* The pre-scaler is buffered too, the update event loads it. With URS set this event doesn't
+		 * set the update flag */
+		LOC_pstrTimer->TIM_EGR = TIM_EGR_UG_SET_MASK;
+		LOC_pstrTimer->TIM_SR = ~(TIM_SR_UIF_SET_MASK);
+		LOC_pstrTimer->TIM_DIER |= TIM_DIER_UIE_SET_MASK;
+	}
+
+	return LOC_enuErrorStatus;
+}
+
+
+/**
+ *@brief : Function to set the period of the update interrupt. While the timer counts, the running
+ * 			period isn't affected and the new one starts at the next update with no time lost.
+ *@param : The timer (TIM_TIMER2 or TIM_TIMER5).
+ *@param : The period in microseconds (from 1 up to 2^32 - 1).
+ *@return: Error status.
+ */
+TIM_enuErrorStatus_t TIM_enuSetPeriodMicroSec(uint32_t Copy_u32Timer, uint32_t Copy_u32PeriodUS)
+{
+	TIM_enuErrorStatus_t LOC_enuErrorStatus = TIM_enuOk;
+
+	if ((Copy_u32Timer != TIM_TIMER2) && (Copy_u32Timer != TIM_TIMER5))
+	{
+		LOC_enuErrorStatus = TIM_enuInvalidTimer;
+	}
+	else if (Copy_u32PeriodUS == 0)
+	{
+		LOC_enuErrorStatus = TIM_enuInvalidPeriodValue;
+	}
+	else
+	{
+		/* The counter counts from zero up to TIMx_ARR, then the update comes */
+		((TIM_strRegsiters_t*)Copy_u32Timer)->TIM_ARR = Copy_u32PeriodUS - 1;
+	}
+
+	return LOC_enuErrorStatus;
+}
+
+
+/**
+ *@brief : Function to start the timer from zero with the last set period.
+ *@param : The timer (TIM_TIMER2 or TIM_TIMER5).
+ *@return: Error status.
+ */
+TIM_enuErrorStatus_t TIM_enuStart(uint32_t Copy_u32Timer)
+{
+	TIM_enuErrorStatus_t LOC_enuErrorStatus = TIM_enuOk;
+	TIM_strRegsiters_t* LOC_pstrTimer = (TIM_strRegsiters_t*)Copy_u32Timer;
+
+	if ((Copy_u32Timer != TIM_TIMER2) && (Copy_u32Timer != TIM_TIMER5))
+	{
+		LOC_enuErrorStatus = TIM_enuInvalidTimer;
+	}
+	else
+	{
+		/* Clear the counter and load the buffered period so the first period is a complete one */
+		LOC_pstrTimer->TIM_EGR = TIM_EGR_UG_SET_MASK;
+		/* One store to the alias of CEN, a start or a stop from an interrupt can't be lost in between */
+		*(volatile uint32_t*)BITBAND_PERIPH_ALIAS_ADDRESS(&(LOC_pstrTimer->TIM_CR1), TIM_CR1_CEN_BIT) = 1;
+	}
+
+	return LOC_enuErrorStatus;
+}
+
+
+/**
+ *@brief : Function to stop the timer.
+ *@param : The timer (TIM_TIMER2 or TIM_TIMER5).
+ *@return: Error status.
+ */
+TIM_enuErrorStatus_t TIM_enuStop(uint32_t Copy_u32Timer)
+{
+	TIM_enuErrorStatus_t LOC_enuErrorStatus = TIM_enuOk;
+
+	if ((Copy_u32Timer != TIM_TIMER2) && (Copy_u32Timer != TIM_TIMER5))
+	{
+		LOC_enuErrorStatus = TIM_enuInvalidTimer;
+	}
+	else
+	{
+		/* One store to the alias of CEN, a start or a stop from an interrupt can't be lost in between */
+		*(volatile uint32_t*)BITBAND_PERIPH_ALIAS_ADDRESS(&(((TIM_strRegsiters_t*)Copy_u32Timer)->TIM_CR1), TIM_CR1_CEN_BIT) = 0;
+	}
+
+	return LOC_enuErrorStatus;
+}
+
+
+/**
+ *@brief : Function to get the microseconds counted in the running period.
+ *@param : The timer (TIM_TIMER2 or TIM_TIMER5).
+ *@param : Pointer to the variable in which the counter will be assigned.
+ *@return: Error status.
+ */
+TIM_enuErrorStatus_t TIM_enuGetCounter(uint32_t Copy_u32Timer, uint32_t* Add_pu32Counter)
+{
+	TIM_enuErrorStatus_t LOC_enuErrorStatus = TIM_enuOk;
+
+	if ((Copy_u32Timer != TIM_TIMER2) && (Copy_u32Timer != TIM_TIMER5))
+	{
+		LOC_enuErrorStatus = TIM_enuInvalidTimer;
+	}
+	else if (Add_pu32Counter == NULL_PTR)
+	{
+		LOC_enuErrorStatus = TIM_enuNullPointer;
+	}
+	else
+	{
+		*Add_pu32Counter = ((TIM_strRegsiters_t*)Copy_u32Timer)->TIM_CNT;
+	}
+
+	return LOC_enuErrorStatus;
+}
+
+
+/**
+ *@brief : Function to set the call back function that is called at every update of the timer.
+ *@param : The timer (TIM_TIMER2 or TIM_TIMER5).
+ *@param : pointer to function that takes a void and returns void.
+ *@return: Error status.
+ */
+TIM_enuErrorStatus_t TIM_enuSetCallBack(uint32_t Copy_u32Timer, timCBF_t Copy_CallBackFunction)
+{
+	TIM_enuErrorStatus_t LOC_enuErrorStatus = TIM_enuOk;
+
+	if ((Copy_u32Timer != TIM_TIMER2) && (Copy_u32Timer != TIM_TIMER5))
+	{
+		LOC_enuErrorStatus = TIM_enuInvalidTimer;
+	}
+	else if (Copy_CallBackFunction == NULL_PTR)
+	{
+		LOC_enuErrorStatus = TIM_enuNullPointer;
+	}
+	else
+	{
+		GLB_CallBackFunctions[(Copy_u32Timer == TIM_TIMER2) ? TIM_TIMER2_INDEX : TIM_TIMER5_INDEX] = Copy_CallBackFunction;
+	}
+
+	return LOC_enuErrorStatus;
+}
+
+
+
+
+void TIM2_IRQHandler (void)
+{
+	TIM_handleUpdate(TIM_TIMER2, TIM_TIMER2_INDEX);
+}
+
+
+void TIM5_IRQHandler (void)
+{
+	TIM_handleUpdate(TIM_TIMER5, TIM_TIMER5_INDEX);
+}
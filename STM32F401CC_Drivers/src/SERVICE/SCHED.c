@@ -18,8 +18,20 @@
 /****************************************************************************************/
 
 
-#include <MCAL/SYSTICK.h>
 #include <SERVICE/SCHED.h>
+#include <CFG/SCHED_cfg.h>
+#include <LIB/cpu_intrinsics.h>
+#include <MCAL/SYSTICK.h>
+#if (SCHED_TIME_BASE != SCHED_TIME_BASE_SYSTICK)
+#include <MCAL/TIM.h>
+#endif
+#if ((SCHED_PROFILING_MODE == SCHED_PROFILING_ENABLE) || (SCHED_TIMING_HEALTH_MODE == SCHED_TIMING_HEALTH_ENABLE) ||\
+	 (SCHED_TRACE_MODE == SCHED_TRACE_ENABLE))
+#include <MCAL/DWT.h>
+#endif
+#if ((SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_ENABLE) || (SCHED_TIME_BASE != SCHED_TIME_BASE_SYSTICK))
+#include <MCAL/NVIC.h>
+#endif
 
 
 
@@ -28,8 +40,195 @@
 /****************************************************************************************/
 
 
-/* Periodicity of our Scheduler */
-#define SCHED_PERIODICITY_MS		1
+/* Mask that maps a tick to its slot in the timing wheel */
+#define SCHED_WHEEL_MASK			(SCHED_WHEEL_SLOTS - 1)
+
+/* Each slot of the wheel is a bit map of the runnables, one bit per runnable */
+#define SCHED_BITS_PER_WORD			(32)
+#define SCHED_WHEEL_WORDS			((SCHED_RUNNABLES_CAPACITY + SCHED_BITS_PER_WORD - 1) / SCHED_BITS_PER_WORD)
+
+/* The free dynamic slots are a bit map too */
+#define SCHED_DYNAMIC_WORDS			((SCHED_DYNAMIC_SLOTS + SCHED_BITS_PER_WORD - 1) / SCHED_BITS_PER_WORD)
+
+
+/* Check first if the user entered an invalid tick or time base */
+#if (SCHED_TICK_US < 10)
+#error "INVALID SCHED_TICK_US is selected :(\nIt must be at least 10 microseconds"
+#endif
+
+#if (SCHED_TIME_BASE == SCHED_TIME_BASE_SYSTICK)
+#if (((SCHED_TICK_US % 1000) != 0) && (SCHED_TICK_US > 1000000))
+#error "INVALID SCHED_TICK_US is selected :(\nA SysTick tick longer than 1 second must be a multiple of 1000 microseconds"
+#endif
+#elif ((SCHED_TIME_BASE != SCHED_TIME_BASE_TIM2) && (SCHED_TIME_BASE != SCHED_TIME_BASE_TIM5))
+#error "INVALID SCHED_TIME_BASE is selected :(\nIt must be SCHED_TIME_BASE_SYSTICK, SCHED_TIME_BASE_TIM2 or SCHED_TIME_BASE_TIM5"
+#endif
+
+/* Check also if the user entered an invalid number of wheel slots */
+#if ((SCHED_WHEEL_SLOTS < 2) || (SCHED_WHEEL_SLOTS > 256) || ((SCHED_WHEEL_SLOTS & (SCHED_WHEEL_SLOTS - 1)) != 0))
+#error "INVALID SCHED_WHEEL_SLOTS is selected :(\nIt must be a power of two from 2 up to 256"
+#endif
+
+/* Check also the tickless mode configurations */
+#if ((SCHED_TICKLESS_MODE != SCHED_TICKLESS_ENABLE) && (SCHED_TICKLESS_MODE != SCHED_TICKLESS_DISABLE))
+#error "INVALID SCHED_TICKLESS_MODE is selected :(\nIt must be either SCHED_TICKLESS_ENABLE or SCHED_TICKLESS_DISABLE"
+#elif ((SCHED_TICKLESS_MODE == SCHED_TICKLESS_ENABLE) && (((SCHED_TICKLESS_MAX_SLEEP_MS * 1000UL) < (2UL * SCHED_TICK_US)) ||\
+		(SCHED_TICKLESS_MAX_SLEEP_MS > 4000000UL)))
+#error "INVALID SCHED_TICKLESS_MAX_SLEEP_MS is selected :(\nIt must be at least two scheduler's ticks and at most 4,000,000 ms"
+#endif
+
+/* Check also the profiling mode configuration */
+#if ((SCHED_PROFILING_MODE != SCHED_PROFILING_ENABLE) && (SCHED_PROFILING_MODE != SCHED_PROFILING_DISABLE))
+#error "INVALID SCHED_PROFILING_MODE is selected :(\nIt must be either SCHED_PROFILING_ENABLE or SCHED_PROFILING_DISABLE"
+#endif
+
+/* Check also the catch-up policy and the timing health configurations */
+#if ((SCHED_CATCHUP_POLICY != SCHED_CATCHUP_RUN_ALL) && (SCHED_CATCHUP_POLICY != SCHED_CATCHUP_COALESCE) &&\
+	 (SCHED_CATCHUP_POLICY != SCHED_CATCHUP_SKIP))
+#error "INVALID SCHED_CATCHUP_POLICY is selected :(\nIt must be SCHED_CATCHUP_RUN_ALL, SCHED_CATCHUP_COALESCE or SCHED_CATCHUP_SKIP"
+#endif
+
+#if ((SCHED_TIMING_HEALTH_MODE != SCHED_TIMING_HEALTH_ENABLE) && (SCHED_TIMING_HEALTH_MODE != SCHED_TIMING_HEALTH_DISABLE))
+#error "INVALID SCHED_TIMING_HEALTH_MODE is selected :(\nIt must be either SCHED_TIMING_HEALTH_ENABLE or SCHED_TIMING_HEALTH_DISABLE"
+#elif ((SCHED_TIMING_HEALTH_MODE == SCHED_TIMING_HEALTH_ENABLE) &&\
+	   ((SCHED_JITTER_BUCKETS < 2) || (SCHED_JITTER_BUCKETS > 32) || (SCHED_JITTER_BUCKET_US < 1)))
+#error "INVALID jitter histogram is selected :(\nSCHED_JITTER_BUCKETS must be from 2 up to 32 and SCHED_JITTER_BUCKET_US at least 1"
+#endif
+
+/* Check also the trace configurations */
+#if ((SCHED_TRACE_MODE != SCHED_TRACE_ENABLE) && (SCHED_TRACE_MODE != SCHED_TRACE_DISABLE))
+#error "INVALID SCHED_TRACE_MODE is selected :(\nIt must be either SCHED_TRACE_ENABLE or SCHED_TRACE_DISABLE"
+#elif ((SCHED_TRACE_MODE == SCHED_TRACE_ENABLE) && ((SCHED_TRACE_RECORDS < 16) || (SCHED_TRACE_RECORDS > 32768) ||\
+	   ((SCHED_TRACE_RECORDS & (SCHED_TRACE_RECORDS - 1)) != 0)))
+#error "INVALID SCHED_TRACE_RECORDS is selected :(\nIt must be a power of two from 16 up to 32768"
+#endif
+
+/* Check also the dispatch policy */
+#if ((SCHED_DISPATCH_POLICY != SCHED_DISPATCH_FIXED_PRIORITY) && (SCHED_DISPATCH_POLICY != SCHED_DISPATCH_EDF))
+#error "INVALID SCHED_DISPATCH_POLICY is selected :(\nIt must be either SCHED_DISPATCH_FIXED_PRIORITY or SCHED_DISPATCH_EDF"
+#elif ((SCHED_DISPATCH_POLICY == SCHED_DISPATCH_EDF) && ((SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_ENABLE) ||\
+		(SCHED_CYCLIC_EXECUTIVE_MODE == SCHED_CYCLIC_EXECUTIVE_ENABLE)))
+#error "SCHED_DISPATCH_EDF can't be used with preemptive or cyclic executive modes :("
+#endif
+
+/* Check also the preemptive mode configurations */
+#if ((SCHED_PREEMPTIVE_MODE != SCHED_PREEMPTIVE_ENABLE) && (SCHED_PREEMPTIVE_MODE != SCHED_PREEMPTIVE_DISABLE))
+#error "INVALID SCHED_PREEMPTIVE_MODE is selected :(\nIt must be either SCHED_PREEMPTIVE_ENABLE or SCHED_PREEMPTIVE_DISABLE"
+#elif (SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_ENABLE)
+#if ((SCHED_PREEMPTIVE_LEVELS < 1) || (SCHED_PREEMPTIVE_LEVELS > 4))
+#error "INVALID SCHED_PREEMPTIVE_LEVELS is selected :(\nIt must be from 1 up to 4"
+#elif ((SCHED_LOWEST_PREEMPTION_LEVEL < SCHED_PREEMPTIVE_LEVELS) || (SCHED_LOWEST_PREEMPTION_LEVEL > PREEMPTION_LEVEL_15))
+#error "INVALID SCHED_LOWEST_PREEMPTION_LEVEL is selected :(\nThe SysTick needs a preemption level above all the priorities"
+#elif (SCHED_TICKLESS_MODE == SCHED_TICKLESS_ENABLE)
+#error "SCHED_PREEMPTIVE_ENABLE can't be used with SCHED_TICKLESS_ENABLE :("
+#endif
+#endif
+
+/* Check also the cyclic executive mode configuration */
+#if ((SCHED_CYCLIC_EXECUTIVE_MODE != SCHED_CYCLIC_EXECUTIVE_ENABLE) && (SCHED_CYCLIC_EXECUTIVE_MODE != SCHED_CYCLIC_EXECUTIVE_DISABLE))
+#error "INVALID SCHED_CYCLIC_EXECUTIVE_MODE is selected :(\nIt must be either SCHED_CYCLIC_EXECUTIVE_ENABLE or SCHED_CYCLIC_EXECUTIVE_DISABLE"
+#elif ((SCHED_CYCLIC_EXECUTIVE_MODE == SCHED_CYCLIC_EXECUTIVE_ENABLE) && ((SCHED_TICKLESS_MODE == SCHED_TICKLESS_ENABLE) ||\
+		(SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_ENABLE) || (SCHED_TIMING_HEALTH_MODE == SCHED_TIMING_HEALTH_ENABLE)))
+#error "SCHED_CYCLIC_EXECUTIVE_ENABLE can't be used with tickless, preemptive or timing health modes :("
+#endif
+
+/* Check also the multi-mode configuration */
+#if ((SCHED_MULTI_MODE != SCHED_MULTI_MODE_ENABLE) && (SCHED_MULTI_MODE != SCHED_MULTI_MODE_DISABLE))
+#error "INVALID SCHED_MULTI_MODE is selected :(\nIt must be either SCHED_MULTI_MODE_ENABLE or SCHED_MULTI_MODE_DISABLE"
+#elif ((SCHED_MULTI_MODE == SCHED_MULTI_MODE_ENABLE) && (SCHED_CYCLIC_EXECUTIVE_MODE == SCHED_CYCLIC_EXECUTIVE_ENABLE))
+#error "SCHED_MULTI_MODE_ENABLE can't be used with SCHED_CYCLIC_EXECUTIVE_ENABLE :("
+#endif
+
+/* Check also the number of dynamic slots */
+#if ((SCHED_DYNAMIC_SLOTS < 0) || (SCHED_DYNAMIC_SLOTS > 64))
+#error "INVALID SCHED_DYNAMIC_SLOTS is selected :(\nIt must be from 0 up to 64"
+#elif ((SCHED_DYNAMIC_SLOTS > 0) && (SCHED_CYCLIC_EXECUTIVE_MODE == SCHED_CYCLIC_EXECUTIVE_ENABLE))
+#error "SCHED_DYNAMIC_SLOTS can't be used with SCHED_CYCLIC_EXECUTIVE_ENABLE :("
+#endif
+
+/* Check also the event queue size */
+#if ((SCHED_EVENT_QUEUE_SIZE < 2) || (SCHED_EVENT_QUEUE_SIZE > 256) || ((SCHED_EVENT_QUEUE_SIZE & (SCHED_EVENT_QUEUE_SIZE - 1)) != 0))
+#error "INVALID SCHED_EVENT_QUEUE_SIZE is selected :(\nIt must be a power of two from 2 up to 256"
+#endif
+
+/* Check also the order of the chains, a consumer after its producer can't make a loop */
+#if (SCHED_CYCLIC_EXECUTIVE_MODE == SCHED_CYCLIC_EXECUTIVE_ENABLE)
+#define SCHED_CHAIN(PRODUCER, CONSUMER)	_Static_assert(0, "SCHED_CHAIN can't be used with SCHED_CYCLIC_EXECUTIVE_ENABLE :(");
+#else
+#define SCHED_CHAIN(PRODUCER, CONSUMER)	_Static_assert(((CONSUMER) > (PRODUCER)) && ((CONSUMER) < _RunnablesNumber_),\
+											"INVALID SCHED_CHAIN(" #PRODUCER ", " #CONSUMER ") :(\nThe consumer must come after its producer in RunnablesList_t");
+#endif
+SCHED_CHAINS_LIST
+#undef SCHED_CHAIN
+
+/* The scheduler's tick is a subscriber of the SysTick interrupt that runs every interrupt, after the
+ * call back of SYSTICK_SetCallBack and before the software timers */
+#define SCHED_SYSTICK_PRIORITY			(1)
+
+/* The longest period of the time base in tickless mode in scheduler's ticks */
+#define SCHED_TICKLESS_MAX_SLEEP_TICKS	((SCHED_TICKLESS_MAX_SLEEP_MS * 1000UL) / SCHED_TICK_US)
+
+#if (SCHED_TIME_BASE == SCHED_TIME_BASE_SYSTICK)
+/* The longest period the SysTick is ever loaded with in scheduler's ticks */
+#if (SCHED_TICKLESS_MODE == SCHED_TICKLESS_ENABLE)
+#define SCHED_MAX_PERIOD_TICKS			SCHED_TICKLESS_MAX_SLEEP_TICKS
+#else
+#define SCHED_MAX_PERIOD_TICKS			1UL
+#endif
+
+/* The SysTick counts of that period, SYSTICK_SetTimeMilliSec counts the AHB/8 clock and
+ * SYSTICK_SetTimeMicroSec counts the AHB clock, both load (counts - 1) in the 24 bits STK_LOAD */
+#if ((SCHED_TICK_US % 1000) == 0)
+#define SCHED_SYSTICK_MAX_PERIOD_COUNTS	(SCHED_MAX_PERIOD_TICKS * (SCHED_TICK_US / 1000UL) * ((AHB_CLOCK_SOURCE_VALUE / 8UL) / 1000UL))
+#else
+#define SCHED_SYSTICK_MAX_PERIOD_COUNTS	(SCHED_MAX_PERIOD_TICKS * SCHED_TICK_US * (AHB_CLOCK_SOURCE_VALUE / 1000000UL))
+#endif
+
+#if (SCHED_SYSTICK_MAX_PERIOD_COUNTS > 0x00FFFFFFUL)
+#if (SCHED_TICKLESS_MODE == SCHED_TICKLESS_ENABLE)
+#error "INVALID SCHED_TICKLESS_MAX_SLEEP_MS is selected :(\nThe SysTick can't count it, it must be at most 0xFFFFFF counts of the SysTick clock"
+#else
+#error "INVALID SCHED_TICK_US is selected :(\nThe SysTick can't count it, it must be at most 0xFFFFFF counts of the SysTick clock"
+#endif
+#endif
+#endif
+
+/* The core clock (HCLK) is the AHB clock that the SysTick is configured with, the DWT counts its cycles */
+#define SCHED_CYCLES_PER_TICK			((AHB_CLOCK_SOURCE_VALUE / 1000000UL) * SCHED_TICK_US)
+#define SCHED_CYCLES_PER_JITTER_BUCKET	((AHB_CLOCK_SOURCE_VALUE / 1000000UL) * SCHED_JITTER_BUCKET_US)
+
+/* Number of the levels that have ready runnables in preemptive mode, the main loop is level zero */
+#define SCHED_READY_LEVELS				(SCHED_PREEMPTIVE_LEVELS + 1)
+/* The four not implemented bits of an NVIC priority field */
+#define SCHED_NVIC_PRIORITY_SHIFT		(4)
+/* The most releases of a runnable that can wait to run */
+#define SCHED_MAX_ACTIVATIONS			(0xFF)
+
+/* "SCTR" in the first bytes of the trace ring, and the mask to get a record from the free running head */
+#define SCHED_TRACE_MAGIC				(0x52544353UL)
+#define SCHED_TRACE_MASK				(SCHED_TRACE_RECORDS - 1)
+
+/* Mask to get the slot of the event queue from the free running indices */
+#define SCHED_EVENT_QUEUE_MASK			(SCHED_EVENT_QUEUE_SIZE - 1)
+
+/* The longest hyperperiod of a mode in ticks, a mode with a longer one switches at any tick */
+#define SCHED_MODE_MAX_HYPERPERIOD		(0x40000000UL)
+
+/* Whether a runnable is in the current mode or not */
+#if (SCHED_MULTI_MODE == SCHED_MULTI_MODE_ENABLE)
+#define SCHED_IS_IN_MODE(RUNNABLE)		((activeRunnables[(RUNNABLE) / SCHED_BITS_PER_WORD] >> ((RUNNABLE) % SCHED_BITS_PER_WORD)) & 1UL)
+#else
+#define SCHED_IS_IN_MODE(RUNNABLE)		(1UL)
+#endif
+
+/* The timer and the IRQ of the time base */
+#if (SCHED_TIME_BASE == SCHED_TIME_BASE_TIM2)
+#define SCHED_TIMER						TIM_TIMER2
+#define SCHED_TIMER_IRQ					IRQ_TIM2
+#elif (SCHED_TIME_BASE == SCHED_TIME_BASE_TIM5)
+#define SCHED_TIMER						TIM_TIMER5
+#define SCHED_TIMER_IRQ					IRQ_TIM5
+#endif
 
 
 
@@ -41,9 +240,49 @@
 /* The reason of "const" is that the scheduler can not add tasks in the runtime */
 extern const runnable_t arrayOfRunnables [_RunnablesNumber_];
 
+#if (SCHED_CYCLIC_EXECUTIVE_MODE == SCHED_CYCLIC_EXECUTIVE_ENABLE)
+/* The generated frame table, each frame is a list of call backs ended by NULL_PTR */
+extern const runnableCB_t* const SCHED_cyclicTable [];
+extern const uint32_t SCHED_cyclicFramesNumber;
+#endif
+
+#if (SCHED_MULTI_MODE == SCHED_MULTI_MODE_ENABLE)
+/* The runnables of each mode */
+extern const SCHED_strMode_t arrayOfModes [_ModesNumber_];
+#endif
+
+/* Run-time data the scheduler keeps for each runnable */
+typedef struct {
+	/* The tick at which this runnable has to run next time */
+	uint32_t nextRelease;
+	/* The periodicity of the runnable converted to scheduler ticks */
+	uint32_t periodTicks;
+#if (SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_ENABLE)
+	/* The priority level the runnable runs at */
+	uint8_t level;
+#endif
+#if ((SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_DISABLE) && (SCHED_CYCLIC_EXECUTIVE_MODE == SCHED_CYCLIC_EXECUTIVE_DISABLE))
+	/* Ticks the runnable asked to sleep for in its last run by SCHED_sleepCurrent, zero if it didn't */
+	uint32_t sleepTicks;
+#endif
+#if (SCHED_DISPATCH_POLICY == SCHED_DISPATCH_EDF)
+	/* The tick of the release that is waiting in the heap, and its deadline (the tick of the next release) */
+	uint32_t releaseTick;
+	uint32_t deadline;
+#endif
+}SCHED_strRunnableCtrl_t;
+
+#if (SCHED_PROFILING_MODE == SCHED_PROFILING_ENABLE)
+/* Execution time measurements the scheduler keeps for each runnable */
 typedef struct {
-	uint8_t delayFlag;
-}privateDelayFlag;
+	/* Sum of the cycles of all the runs, the mean is calculated from it only when it's asked for */
+	uint64_t totalCycles;
+	uint32_t runsCount;
+	uint32_t lastCycles;
+	uint32_t minCycles;
+	uint32_t maxCycles;
+}SCHED_strRunnableProfile_t;
+#endif
 
 
 
@@ -52,90 +291,2391 @@ typedef struct {
 /****************************************************************************************/
 
 
-/* The reason of "volatile" is that */
-static volatile uint32_t pendingTasks = 0;
+/* Number of ticks ended since the scheduler started, it's only written inside the SysTick handler and the
+ * main loop catches up with it, the reason of "volatile" is that it's read in the main loop */
+static volatile uint32_t tickCount = 0;
+
+/* The current time of the scheduler in ticks, the next tick the main loop will process */
+static uint32_t timeStamp = 0;
+
+/* The run-time data of each runnable, indexed the same as "arrayOfRunnables" then the dynamic slots */
+static SCHED_strRunnableCtrl_t arrayOfRunnablesCtrl [SCHED_RUNNABLES_CAPACITY];
+
+/* The timing wheel, the bit of a runnable is set in the slot of its next release. Bits are scanned
+ * from the lowest index so runnables released at the same tick keep the priority order of
+ * "arrayOfRunnables" */
+#if (SCHED_CYCLIC_EXECUTIVE_MODE == SCHED_CYCLIC_EXECUTIVE_DISABLE)
+static uint32_t timingWheel [SCHED_WHEEL_SLOTS][SCHED_WHEEL_WORDS];
+#else
+/* Index of the frame that runs at the next tick */
+static uint32_t cyclicFrame = 0;
+#endif
+
+#if (SCHED_TICKLESS_MODE == SCHED_TICKLESS_ENABLE)
+/* The SysTick reloads its period by hardware with no time lost, so the period is only changed while
+ * another one is running. "runningPeriodTicks" is the period the SysTick counts now and
+ * "loadedPeriodTicks" is the one it will reload when the running one ends */
+static uint32_t runningPeriodTicks = 1;
+static uint32_t loadedPeriodTicks = 1;
+
+/* The tick at which the main loop wants to be woken up, written before it sleeps */
+static volatile uint32_t nextWakeUpTick = 0;
+#endif
+
+#if (SCHED_PROFILING_MODE == SCHED_PROFILING_ENABLE)
+/* The execution time measurements of each runnable, indexed the same as "arrayOfRunnablesCtrl" */
+static SCHED_strRunnableProfile_t arrayOfRunnablesProfile [SCHED_RUNNABLES_CAPACITY];
+
+/* Cycles consumed by the last scheduler's tick and by the longest one */
+static uint32_t lastTickCycles = 0;
+static uint32_t maxTickCycles = 0;
+
+/* Cycles consumed by the scheduler's ticks, and all the cycles passed, since the measuring started.
+ * The cycle counter wraps around so the passed cycles are added up at the end of every tick */
+static uint64_t busyCycles = 0;
+static uint64_t elapsedCycles = 0;
+static uint32_t lastSampleCycles = 0;
+#endif
+
+#if (SCHED_TIMING_HEALTH_MODE == SCHED_TIMING_HEALTH_ENABLE)
+/* The timing health counters and histograms */
+static SCHED_strHealth_t timingHealth;
+
+/* The cycle counter value when the SysTick handler counted the last tick, written inside the SysTick handler */
+static volatile uint32_t tickEndCycles = 0;
+
+/* Copies of "tickCount" and "tickEndCycles" that are taken together by the main loop, the release
+ * time of any tick is calculated from them */
+static uint32_t refTickCount = 0;
+static uint32_t refTickEndCycles = 0;
+#endif
+
+#if (SCHED_TRACE_MODE == SCHED_TRACE_ENABLE)
+/* The trace ring, it isn't static so a debugger can find it by its name */
+SCHED_strTrace_t schedTrace;
+#endif
+
+/* The distance from each runnable to its consumer in the chains (a consumer always comes after its
+ * producer), zero if it has no consumer */
+static const uint8_t arrayOfChainOffsets [SCHED_RUNNABLES_CAPACITY] = {
+#define SCHED_CHAIN(PRODUCER, CONSUMER)	[PRODUCER] = (CONSUMER) - (PRODUCER),
+	SCHED_CHAINS_LIST
+#undef SCHED_CHAIN
+};
+
+#if (SCHED_DISPATCH_POLICY == SCHED_DISPATCH_EDF)
+/* The released runnables that are waiting to run, a binary min-heap ordered by their deadlines */
+static uint16_t readyHeap [SCHED_RUNNABLES_CAPACITY];
+static uint32_t readyHeapSize = 0;
+
+/* The position of each runnable in the heap plus one, zero if it isn't waiting */
+static uint16_t heapPosition [SCHED_RUNNABLES_CAPACITY];
+#endif
+
+#if (SCHED_DYNAMIC_SLOTS > 0)
+/* The runnables added by SCHED_addRunnable, a free slot has no call back */
+static runnable_t dynamicRunnables [SCHED_DYNAMIC_SLOTS];
+
+/* The free dynamic slots, one bit per slot */
+static uint32_t freeSlots [SCHED_DYNAMIC_WORDS];
+#endif
+
+#if (SCHED_MULTI_MODE == SCHED_MULTI_MODE_ENABLE)
+/* The mode the scheduler runs now and the one asked for by SCHED_requestMode, a switch is pending
+ * while they differ */
+static volatile uint32_t currentMode = 0;
+static volatile uint32_t requestedMode = 0;
+
+/* The tick the current mode started at, it's moved forward by "modeRebaseTicks" (whole hyperperiods)
+ * so the ticks passed since it never wrap around */
+static uint32_t modeStart = 0;
+static uint32_t modeHyperperiod = 1;
+static uint32_t modeRebaseTicks = SCHED_MODE_MAX_HYPERPERIOD;
+
+/* The runnables of the current mode, one bit per runnable as in the wheel */
+static volatile uint32_t activeRunnables [SCHED_WHEEL_WORDS];
+#endif
+
+#if ((SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_DISABLE) && (SCHED_CYCLIC_EXECUTIVE_MODE == SCHED_CYCLIC_EXECUTIVE_DISABLE))
+/* Index of the runnable that is running now or ran last, SCHED_sleepCurrent applies to it */
+static uint32_t runningRunnable = 0;
+#endif
+
+/* Ring of the posted events, "eventHead" is written only by SCHED_postEvent and "eventTail" only by
+ * the scheduler, so neither side needs a lock. Both are free running and masked on access */
+static volatile uint16_t eventQueue [SCHED_EVENT_QUEUE_SIZE];
+static volatile uint32_t eventHead = 0;
+static volatile uint32_t eventTail = 0;
+
+#if (SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_ENABLE)
+/* The runnables that are released and waiting to run at each level, one bit per runnable as in the wheel */
+static volatile uint32_t readyRunnables [SCHED_READY_LEVELS][SCHED_WHEEL_WORDS];
+
+/* Number of releases of each runnable that haven't run yet */
+static volatile uint8_t pendingActivations [SCHED_RUNNABLES_CAPACITY];
+
+#if (SCHED_PREEMPTIVE_LEVELS >= 2)
+/* The IRQs that run the priorities from 2 and above */
+static const IRQs_t arrayOfLevelsIRQ [SCHED_PREEMPTIVE_LEVELS - 1] = {
+	SCHED_PRIORITY_2_IRQ,
+#if (SCHED_PREEMPTIVE_LEVELS >= 3)
+	SCHED_PRIORITY_3_IRQ,
+#endif
+#if (SCHED_PREEMPTIVE_LEVELS >= 4)
+	SCHED_PRIORITY_4_IRQ,
+#endif
+};
+#endif
+
+#if (SCHED_TIMING_HEALTH_MODE == SCHED_TIMING_HEALTH_ENABLE)
+/* The cycle counter value at the last release of each runnable */
+static uint32_t arrayOfReleaseCycles [SCHED_RUNNABLES_CAPACITY];
+#endif
+
+#if (SCHED_PROFILING_MODE == SCHED_PROFILING_ENABLE)
+/* Cycles the core spent sleeping in the main loop, the rest of the time is consumed by the scheduler */
+static uint64_t idleCycles = 0;
+#endif
+#endif
+
 
-privateDelayFlag arrayOfRunnablesDelayFlag [_RunnablesNumber_] = {0};
 
 /****************************************************************************************/
 /*								Static Functions' Declaration							*/
 /****************************************************************************************/
 
 
+#if (SCHED_CYCLIC_EXECUTIVE_MODE == SCHED_CYCLIC_EXECUTIVE_DISABLE)
 /**
- *@brief : Function that initializes the scheduler.
- *@param : void.
+ *@brief : Function that sets the bit of a runnable in the wheel slot of its next release.
+ *@param : Index of the runnable in "arrayOfRunnables".
+ *@return: void.
+ */
+static inline void SCHED_insertInWheel(uint32_t Copy_u32Runnable)
+{
+	timingWheel[arrayOfRunnablesCtrl[Copy_u32Runnable].nextRelease & SCHED_WHEEL_MASK][Copy_u32Runnable / SCHED_BITS_PER_WORD]\
+			|= (1UL << (Copy_u32Runnable % SCHED_BITS_PER_WORD));
+}
+
+
+/**
+ *@brief : Function that clears the bit of a runnable in the wheel slot of its next release.
+ *@param : Index of the runnable in "arrayOfRunnablesCtrl".
+ *@return: void.
+ */
+static inline void SCHED_removeFromWheel(uint32_t Copy_u32Runnable)
+{
+	timingWheel[arrayOfRunnablesCtrl[Copy_u32Runnable].nextRelease & SCHED_WHEEL_MASK][Copy_u32Runnable / SCHED_BITS_PER_WORD]\
+			&= ~(1UL << (Copy_u32Runnable % SCHED_BITS_PER_WORD));
+}
+
+
+/**
+ *@brief : Function that moves the release of a runnable that has just run at the current tick to its next
+ * 			period, unless the runnable was removed (or its slot was taken again) while it was running.
+ *@param : Index of the runnable in "arrayOfRunnablesCtrl".
+ *@return: void.
+ */
+static inline void SCHED_advanceRelease(uint32_t Copy_u32Runnable)
+{
+#if (SCHED_DYNAMIC_SLOTS > 0)
+	/* A runnable added while this tick was processed is released after it */
+	if (arrayOfRunnablesCtrl[Copy_u32Runnable].nextRelease == timeStamp)
+	{
+		arrayOfRunnablesCtrl[Copy_u32Runnable].nextRelease += arrayOfRunnablesCtrl[Copy_u32Runnable].periodTicks;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+#else
+	arrayOfRunnablesCtrl[Copy_u32Runnable].nextRelease += arrayOfRunnablesCtrl[Copy_u32Runnable].periodTicks;
+#endif
+}
+#endif
+
+
+/**
+ *@brief : Function that gets the configuration of a runnable.
+ *@param : Index of the runnable in "arrayOfRunnablesCtrl".
+ *@return: Pointer to the runnable in "arrayOfRunnables" or in the dynamic slots.
+ */
+static inline const runnable_t* SCHED_getRunnable(uint32_t Copy_u32Runnable)
+{
+#if (SCHED_DYNAMIC_SLOTS > 0)
+	const runnable_t* LOC_pstrRunnable;
+
+	if (Copy_u32Runnable < _RunnablesNumber_)
+	{
+		LOC_pstrRunnable = &arrayOfRunnables[Copy_u32Runnable];
+	}
+	else
+	{
+		LOC_pstrRunnable = &dynamicRunnables[Copy_u32Runnable - _RunnablesNumber_];
+	}
+
+	return LOC_pstrRunnable;
+#else
+	return &arrayOfRunnables[Copy_u32Runnable];
+#endif
+}
+
+
+/**
+ *@brief : Function that gets the period of a runnable in scheduler's ticks.
+ *@param : Index of the runnable in "arrayOfRunnablesCtrl".
+ *@return: Number of ticks, zero if the runnable isn't released by time.
+ */
+static inline uint32_t SCHED_getPeriodTicks(uint32_t Copy_u32Runnable)
+{
+	const runnable_t* LOC_pstrRunnable = SCHED_getRunnable(Copy_u32Runnable);
+	uint32_t LOC_u32PeriodTicks = LOC_pstrRunnable->periodicityUS / SCHED_TICK_US;
+
+	/* A runnable without a call back never runs and an event runnable isn't released by time,
+	 * mark both of them with a zero period */
+	if ((LOC_pstrRunnable->callBackFn == NULL_PTR) || (LOC_pstrRunnable->activation == SCHED_ACTIVATION_EVENT))
+	{
+		LOC_u32PeriodTicks = 0;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	return LOC_u32PeriodTicks;
+}
+
+
+#if (SCHED_MULTI_MODE == SCHED_MULTI_MODE_ENABLE)
+/**
+ *@brief : Function that gets the greatest common divisor of two numbers.
+ *@param : The first number.
+ *@param : The second number.
+ *@return: The greatest common divisor.
+ */
+static uint32_t SCHED_gcd(uint32_t Copy_u32A, uint32_t Copy_u32B)
+{
+	uint32_t LOC_u32Remainder;
+
+	while (Copy_u32B != 0)
+	{
+		LOC_u32Remainder = Copy_u32A % Copy_u32B;
+		Copy_u32A = Copy_u32B;
+		Copy_u32B = LOC_u32Remainder;
+	}
+
+	return Copy_u32A;
+}
+
+
+/**
+ *@brief : Function that switches to a mode at the current tick, only the runnables of that mode stay in
+ * 			the wheel and each one of them is released after its first delay from now as at the start.
+ *@param : Index of the mode in "arrayOfModes".
  *@return: void.
  */
-static void SCHED_sched(void)
+static void SCHED_enterMode(uint32_t Copy_u32Mode)
 {
-	uint32_t index;
-	static uint32_t timeStamp = 0;
-	for(index = 0; index < _RunnablesNumber_; index++)
+	const RunnablesList_t* LOC_penuRunnable = arrayOfModes[Copy_u32Mode].runnables;
+	uint64_t LOC_u64Hyperperiod = 1;
+	uint32_t LOC_u32Index;
+	uint32_t LOC_u32PeriodTicks;
+
+	/* Take all the runnables of "arrayOfRunnables" out, the ones of the new mode get in again. The
+	 * dynamic runnables are not part of any mode and stay as they are */
+	for (LOC_u32Index = 0; LOC_u32Index < _RunnablesNumber_; LOC_u32Index++)
+	{
+		if (arrayOfRunnablesCtrl[LOC_u32Index].periodTicks != 0)
+		{
+			SCHED_removeFromWheel(LOC_u32Index);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+
+		activeRunnables[LOC_u32Index / SCHED_BITS_PER_WORD] &= ~(1UL << (LOC_u32Index % SCHED_BITS_PER_WORD));
+		arrayOfRunnablesCtrl[LOC_u32Index].periodTicks = 0;
+#if (SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_DISABLE)
+		arrayOfRunnablesCtrl[LOC_u32Index].sleepTicks = 0;
+#endif
+	}
+
+	while ((LOC_penuRunnable != NULL_PTR) && (*LOC_penuRunnable < _RunnablesNumber_))
 	{
-		if (timeStamp >= arrayOfRunnables[index].firstDelay && arrayOfRunnablesDelayFlag[index].delayFlag == 0)
+		LOC_u32Index = *LOC_penuRunnable;
+		LOC_penuRunnable++;
+
+		activeRunnables[LOC_u32Index / SCHED_BITS_PER_WORD] |= (1UL << (LOC_u32Index % SCHED_BITS_PER_WORD));
+
+		LOC_u32PeriodTicks = SCHED_getPeriodTicks(LOC_u32Index);
+		if (LOC_u32PeriodTicks != 0)
 		{
-			timeStamp = 0;
-			arrayOfRunnablesDelayFlag[index].delayFlag = 1;
+			arrayOfRunnablesCtrl[LOC_u32Index].periodTicks = LOC_u32PeriodTicks;
+			arrayOfRunnablesCtrl[LOC_u32Index].nextRelease = timeStamp + (arrayOfRunnables[LOC_u32Index].firstDelayUS / SCHED_TICK_US);
+			SCHED_insertInWheel(LOC_u32Index);
+
+			/* The hyperperiod is the least common multiple of the periods, once it's too long it stays too long */
+			if (LOC_u64Hyperperiod <= SCHED_MODE_MAX_HYPERPERIOD)
+			{
+				LOC_u64Hyperperiod = (LOC_u64Hyperperiod / SCHED_gcd((uint32_t)LOC_u64Hyperperiod, LOC_u32PeriodTicks)) * LOC_u32PeriodTicks;
+			}
+			else
+			{
+				/* Do Nothing */
+			}
 		}
-		/* Check on the CallBack pointer that it isn't a NULL pointer and check
-		 * if the time of this runnable comes */
-		if((arrayOfRunnables[index].callBackFn)\
-				&& ((timeStamp % (arrayOfRunnables[index].periodicityMS)) == 0) && (arrayOfRunnablesDelayFlag[index].delayFlag == 1))
+		else
 		{
-			/* If everything is OK, call the CallBackFn of this runnable */
-			arrayOfRunnables[index].callBackFn();
+			/* Do Nothing, the event runnables are only marked in the mode */
 		}
 	}
-	/* Plus the periodicity of our scheduler to the timeStamp variable because when this function
-	 * be called next time, the time passed will be equal to the scheduler's periodicity  */
-	timeStamp += SCHED_PERIODICITY_MS;
+
+	/* With no boundary to wait for, the next switch is done at any tick */
+	if (LOC_u64Hyperperiod > SCHED_MODE_MAX_HYPERPERIOD)
+	{
+		LOC_u64Hyperperiod = 1;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	currentMode = Copy_u32Mode;
+	modeStart = timeStamp;
+	modeHyperperiod = (uint32_t)LOC_u64Hyperperiod;
+	modeRebaseTicks = modeHyperperiod * (SCHED_MODE_MAX_HYPERPERIOD / modeHyperperiod);
+}
+
+
+/**
+ *@brief : Function that gets the number of ticks from the current one until the next hyperperiod
+ * 			boundary of the current mode.
+ *@param : void.
+ *@return: Number of ticks, 0 means the current tick is a boundary.
+ */
+static inline uint32_t SCHED_ticksToModeBoundary(void)
+{
+	return (modeHyperperiod - ((timeStamp - modeStart) % modeHyperperiod)) % modeHyperperiod;
 }
+#endif
 
 
+/**
+ *@brief : Function that sets the period of the time base, a running period isn't affected and the new
+ * 			one starts when it ends.
+ *@param : Number of scheduler's ticks.
+ *@return: Error status, SCHED_enuNotOk if the time base refused the period and kept the old one.
+ */
+static inline SCHED_enuErrorStatus_t SCHED_setTimeBasePeriod(uint32_t Copy_u32Ticks)
+{
+	SCHED_enuErrorStatus_t LOC_enuErrorStatus = SCHED_enuOk;
 
-/****************************************************************************************/
-/*								Functions' Implementation								*/
-/****************************************************************************************/
+#if (SCHED_TIME_BASE != SCHED_TIME_BASE_SYSTICK)
+	if (TIM_enuSetPeriodMicroSec(SCHED_TIMER, Copy_u32Ticks * SCHED_TICK_US) != TIM_enuOk)
+#elif ((SCHED_TICK_US % 1000) == 0)
+	if (SYSTICK_SetTimeMilliSec(Copy_u32Ticks * (SCHED_TICK_US / 1000)) != SYSTICK_enuOk)
+#else
+	if (SYSTICK_SetTimeMicroSec(Copy_u32Ticks * SCHED_TICK_US) != SYSTICK_enuOk)
+#endif
+	{
+		LOC_enuErrorStatus = SCHED_enuNotOk;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	return LOC_enuErrorStatus;
+}
 
 
 /**
- *@brief : Function that .
+ *@brief : Function that starts the time base, the first tick ends after a complete period.
  *@param : void.
  *@return: void.
  */
-void tickCallBack(void)
+static inline void SCHED_startTimeBase(void)
 {
-	pendingTasks++;
+#if (SCHED_TIME_BASE != SCHED_TIME_BASE_SYSTICK)
+	TIM_enuStart(SCHED_TIMER);
+#else
+	SYSTICK_Start(START_PERIODIC);
+#endif
 }
 
 
+#if (SCHED_TICKLESS_MODE == SCHED_TICKLESS_ENABLE)
 /**
- *@brief : Function that initializes the scheduler.
+ *@brief : Function that gets the number of ticks from now until the next release of any runnable.
  *@param : void.
+ *@return: Number of ticks (0 means a runnable is released at the current tick), limited to
+ * 			SCHED_TICKLESS_MAX_SLEEP_TICKS.
+ */
+static uint32_t SCHED_ticksToNextRelease(void)
+{
+	uint32_t LOC_u32Distance = SCHED_TICKLESS_MAX_SLEEP_TICKS;
+	uint32_t LOC_u32Runnable;
+
+	for (LOC_u32Runnable = 0; LOC_u32Runnable < SCHED_RUNNABLES_CAPACITY; LOC_u32Runnable++)
+	{
+		/* Only the runnables that are in the wheel are released */
+		if ((arrayOfRunnablesCtrl[LOC_u32Runnable].periodTicks != 0) &&
+			((arrayOfRunnablesCtrl[LOC_u32Runnable].nextRelease - timeStamp) < LOC_u32Distance))
+		{
+			LOC_u32Distance = arrayOfRunnablesCtrl[LOC_u32Runnable].nextRelease - timeStamp;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+
+#if (SCHED_MULTI_MODE == SCHED_MULTI_MODE_ENABLE)
+	/* A pending mode switch has to be done at its boundary */
+	if ((requestedMode != currentMode) && (SCHED_ticksToModeBoundary() < LOC_u32Distance))
+	{
+		LOC_u32Distance = SCHED_ticksToModeBoundary();
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+#endif
+
+	return LOC_u32Distance;
+}
+#endif
+
+
+#if (SCHED_PROFILING_MODE == SCHED_PROFILING_ENABLE)
+/**
+ *@brief : Function that adds one run of a runnable to its execution time measurements.
+ *@param : Index of the runnable in "arrayOfRunnables".
+ *@param : Cycles consumed by this run.
+ *@return: void.
+ */
+static inline void SCHED_profileRunnable(uint32_t Copy_u32Runnable, uint32_t Copy_u32Cycles)
+{
+	SCHED_strRunnableProfile_t* LOC_pstrProfile = &arrayOfRunnablesProfile[Copy_u32Runnable];
+
+	LOC_pstrProfile->totalCycles += Copy_u32Cycles;
+	LOC_pstrProfile->runsCount++;
+	LOC_pstrProfile->lastCycles = Copy_u32Cycles;
+
+	if (Copy_u32Cycles < LOC_pstrProfile->minCycles)
+	{
+		LOC_pstrProfile->minCycles = Copy_u32Cycles;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	if (Copy_u32Cycles > LOC_pstrProfile->maxCycles)
+	{
+		LOC_pstrProfile->maxCycles = Copy_u32Cycles;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+
+/**
+ *@brief : Function that adds one scheduler's tick to the CPU load measurements.
+ *@param : The cycle counter value at the beginning of the tick.
+ *@return: void.
+ */
+static inline void SCHED_profileTick(uint32_t Copy_u32StartCycles)
+{
+	uint32_t LOC_u32Now = DWT_u32GetCycleCount();
+
+	lastTickCycles = LOC_u32Now - Copy_u32StartCycles;
+	if (lastTickCycles > maxTickCycles)
+	{
+		maxTickCycles = lastTickCycles;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	busyCycles += lastTickCycles;
+	elapsedCycles += LOC_u32Now - lastSampleCycles;
+	lastSampleCycles = LOC_u32Now;
+}
+
+
+/**
+ *@brief : Function that clears the execution time measurements of a runnable.
+ *@param : Index of the runnable in "arrayOfRunnablesCtrl".
  *@return: void.
  */
-void SCHED_init(void)
+static void SCHED_clearProfile(uint32_t Copy_u32Runnable)
 {
-	SYSTICK_SetTimeMilliSec(SCHED_PERIODICITY_MS);
-	SYSTICK_SetCallBack(tickCallBack);
+	arrayOfRunnablesProfile[Copy_u32Runnable].totalCycles = 0;
+	arrayOfRunnablesProfile[Copy_u32Runnable].runsCount = 0;
+	arrayOfRunnablesProfile[Copy_u32Runnable].lastCycles = 0;
+	arrayOfRunnablesProfile[Copy_u32Runnable].minCycles = 0xFFFFFFFFUL;
+	arrayOfRunnablesProfile[Copy_u32Runnable].maxCycles = 0;
 }
+#endif
 
 
+#if (SCHED_TIMING_HEALTH_MODE == SCHED_TIMING_HEALTH_ENABLE)
 /**
- *@brief : Function that starts the scheduler.
- *@param : void.
+ *@brief : Function that records the delay between the release of a runnable at the current tick and its start.
+ *@param : Index of the runnable in "arrayOfRunnables".
+ *@param : The cycle counter value when the runnable started.
  *@return: void.
  */
-void SCHED_start(void)
+static inline void SCHED_recordJitter(uint32_t Copy_u32Runnable, uint32_t Copy_u32StartCycles)
 {
-	SYSTICK_Start(START_PERIODIC);
-	while (1)
+	SCHED_strRunnableHealth_t* LOC_pstrHealth = &timingHealth.runnables[Copy_u32Runnable];
+	uint32_t LOC_u32Jitter;
+	uint32_t LOC_u32Bucket;
+
+#if (SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_ENABLE)
+	/* The release was stamped by the SysTick handler */
+	LOC_u32Jitter = Copy_u32StartCycles - arrayOfReleaseCycles[Copy_u32Runnable];
+#elif (SCHED_DISPATCH_POLICY == SCHED_DISPATCH_EDF)
+	/* The release is the end of its tick, calculated backwards from the last tick counted */
+	LOC_u32Jitter = Copy_u32StartCycles - (refTickEndCycles -
+			((refTickCount - (arrayOfRunnablesCtrl[Copy_u32Runnable].releaseTick + 1)) * SCHED_CYCLES_PER_TICK));
+#else
+	/* The release is the end of the current tick, calculated backwards from the last tick counted */
+	LOC_u32Jitter = Copy_u32StartCycles -
+			(refTickEndCycles - ((refTickCount - (timeStamp + 1)) * SCHED_CYCLES_PER_TICK));
+#endif
+
+	if (LOC_u32Jitter > LOC_pstrHealth->maxJitterCycles)
+	{
+		LOC_pstrHealth->maxJitterCycles = LOC_u32Jitter;
+	}
+	else
 	{
-		if(pendingTasks)
+		/* Do Nothing */
+	}
+
+	LOC_u32Bucket = LOC_u32Jitter / SCHED_CYCLES_PER_JITTER_BUCKET;
+	if (LOC_u32Bucket >= SCHED_JITTER_BUCKETS)
+	{
+		LOC_u32Bucket = SCHED_JITTER_BUCKETS - 1;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+	LOC_pstrHealth->jitterHistogram[LOC_u32Bucket]++;
+}
+
+
+/**
+ *@brief : Function that records how many ticks the main loop is behind.
+ *@param : Number of ticks.
+ *@return: void.
+ */
+static inline void SCHED_recordBacklog(uint32_t Copy_u32Ticks)
+{
+	if (Copy_u32Ticks != 0)
+	{
+		timingHealth.backlogEvents++;
+		if (Copy_u32Ticks > timingHealth.maxBacklogTicks)
+		{
+			timingHealth.maxBacklogTicks = Copy_u32Ticks;
+		}
+		else
 		{
-			pendingTasks--;
-			SCHED_sched();
+			/* Do Nothing */
 		}
 	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+
+/**
+ *@brief : Function that clears the timing health counters and histogram of a runnable.
+ *@param : Index of the runnable in "arrayOfRunnablesCtrl".
+ *@return: void.
+ */
+static void SCHED_clearHealth(uint32_t Copy_u32Runnable)
+{
+	uint32_t LOC_u32Bucket;
+
+	timingHealth.runnables[Copy_u32Runnable].deadlineMisses = 0;
+	timingHealth.runnables[Copy_u32Runnable].maxJitterCycles = 0;
+	for (LOC_u32Bucket = 0; LOC_u32Bucket < SCHED_JITTER_BUCKETS; LOC_u32Bucket++)
+	{
+		timingHealth.runnables[Copy_u32Runnable].jitterHistogram[LOC_u32Bucket] = 0;
+	}
+}
+#endif
+
+
+/**
+ *@brief : Function that gets the number of ticks ended until now.
+ *@param : void.
+ *@return: Number of ticks.
+ */
+static inline uint32_t SCHED_getTickCount(void)
+{
+#if (SCHED_TIMING_HEALTH_MODE == SCHED_TIMING_HEALTH_ENABLE)
+	/* The tick count and the cycles of its end have to be taken from the same SysTick interrupt */
+	CPU_DisableInterrupts();
+	refTickCount = tickCount;
+	refTickEndCycles = tickEndCycles;
+	CPU_EnableInterrupts();
+
+	return refTickCount;
+#else
+	return tickCount;
+#endif
+}
+
+
+#if (SCHED_TRACE_MODE == SCHED_TRACE_ENABLE)
+/**
+ *@brief : Function that writes a record in the trace ring, over the oldest one if the ring is full.
+ *@param : Type of the record, from SCHED_TRACE_RUNNABLE_BEGIN to SCHED_TRACE_ISR_END.
+ *@param : Index of the runnable or IRQ number of the interrupt.
+ *@return: void.
+ */
+static inline void SCHED_writeTrace(uint32_t Copy_u32Type, uint32_t Copy_u32Id)
+{
+	SCHED_strTraceRecord_t* LOC_pstrRecord;
+	uint32_t LOC_u32Primask;
+
+	if (schedTrace.recording != 0)
+	{
+		/* An interrupt can't take the same record or write an earlier time after this one, and this may be
+		 * called while the interrupts are already masked */
+		LOC_u32Primask = CPU_SaveAndDisableInterrupts();
+		LOC_pstrRecord = &schedTrace.records[schedTrace.head & SCHED_TRACE_MASK];
+		LOC_pstrRecord->cycles = DWT_u32GetCycleCount();
+		LOC_pstrRecord->id = (uint16_t)Copy_u32Id;
+		LOC_pstrRecord->type = (uint8_t)Copy_u32Type;
+		schedTrace.head++;
+		CPU_RestoreInterrupts(LOC_u32Primask);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+#endif
+
+
+/**
+ *@brief : Function that calls the CallBackFn of a runnable released at the current tick, then the ones of
+ * 			its chain.
+ *@param : Index of the runnable in "arrayOfRunnables".
+ *@return: void.
+ */
+static inline void SCHED_runRunnable(uint32_t Copy_u32Runnable)
+{
+	uint32_t LOC_u32Offset;
+#if ((SCHED_PROFILING_MODE == SCHED_PROFILING_ENABLE) || (SCHED_TIMING_HEALTH_MODE == SCHED_TIMING_HEALTH_ENABLE))
+	uint32_t LOC_u32RunStart = DWT_u32GetCycleCount();
+#endif
+
+#if (SCHED_TIMING_HEALTH_MODE == SCHED_TIMING_HEALTH_ENABLE)
+	/* Only the periodic runnables have a release tick to measure from */
+	if (arrayOfRunnablesCtrl[Copy_u32Runnable].periodTicks != 0)
+	{
+		SCHED_recordJitter(Copy_u32Runnable, LOC_u32RunStart);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+#endif
+
+	do
+	{
+#if ((SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_DISABLE) && (SCHED_CYCLIC_EXECUTIVE_MODE == SCHED_CYCLIC_EXECUTIVE_DISABLE))
+		runningRunnable = Copy_u32Runnable;
+#endif
+
+#if (SCHED_TRACE_MODE == SCHED_TRACE_ENABLE)
+		SCHED_writeTrace(SCHED_TRACE_RUNNABLE_BEGIN, Copy_u32Runnable);
+		SCHED_getRunnable(Copy_u32Runnable)->callBackFn();
+		SCHED_writeTrace(SCHED_TRACE_RUNNABLE_END, Copy_u32Runnable);
+#else
+		SCHED_getRunnable(Copy_u32Runnable)->callBackFn();
+#endif
+
+#if (SCHED_PROFILING_MODE == SCHED_PROFILING_ENABLE)
+		SCHED_profileRunnable(Copy_u32Runnable, DWT_u32GetCycleCount() - LOC_u32RunStart);
+#endif
+
+		/* Move to the consumer, the ones without a call back or out of the current mode are passed over
+		 * to their own consumers */
+		do
+		{
+			LOC_u32Offset = arrayOfChainOffsets[Copy_u32Runnable];
+			Copy_u32Runnable += LOC_u32Offset;
+		} while ((LOC_u32Offset != 0) &&
+				 ((SCHED_getRunnable(Copy_u32Runnable)->callBackFn == NULL_PTR) || (SCHED_IS_IN_MODE(Copy_u32Runnable) == 0)));
+
+#if (SCHED_PROFILING_MODE == SCHED_PROFILING_ENABLE)
+		LOC_u32RunStart = DWT_u32GetCycleCount();
+#endif
+	} while (LOC_u32Offset != 0);
+}
+
+
+#if (SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_ENABLE)
+/**
+ *@brief : Function that triggers the exception that runs a level.
+ *@param : The level.
+ *@return: void.
+ */
+static inline void SCHED_pendLevel(uint32_t Copy_u32Level)
+{
+	/* Level zero is the main loop, it finds its runnables by itself */
+	if (Copy_u32Level == 1)
+	{
+		NVIC_SetPendingSystemHandler(SYSTEM_HANDLER_PENDSV);
+	}
+#if (SCHED_PREEMPTIVE_LEVELS >= 2)
+	else if (Copy_u32Level >= 2)
+	{
+		NVIC_SetPendingIRQ(arrayOfLevelsIRQ[Copy_u32Level - 2]);
+	}
+#endif
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+
+/**
+ *@brief : Function that makes a runnable ready at its level and triggers the exception of that level,
+ * 			called with the SysTick masked.
+ *@param : Index of the runnable in "arrayOfRunnables".
+ *@return: void.
+ */
+static void SCHED_activateRunnable(uint32_t Copy_u32Runnable)
+{
+	uint32_t LOC_u32Level = arrayOfRunnablesCtrl[Copy_u32Runnable].level;
+
+	if (pendingActivations[Copy_u32Runnable] == 0)
+	{
+		pendingActivations[Copy_u32Runnable] = 1;
+		readyRunnables[LOC_u32Level][Copy_u32Runnable / SCHED_BITS_PER_WORD] |= (1UL << (Copy_u32Runnable % SCHED_BITS_PER_WORD));
+
+#if (SCHED_TIMING_HEALTH_MODE == SCHED_TIMING_HEALTH_ENABLE)
+		arrayOfReleaseCycles[Copy_u32Runnable] = tickEndCycles;
+#endif
+
+		SCHED_pendLevel(LOC_u32Level);
+	}
+	else
+	{
+		/* The previous release hasn't run yet, events have no deadline */
+#if (SCHED_TIMING_HEALTH_MODE == SCHED_TIMING_HEALTH_ENABLE)
+		if (arrayOfRunnablesCtrl[Copy_u32Runnable].periodTicks != 0)
+		{
+			timingHealth.runnables[Copy_u32Runnable].deadlineMisses++;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+#endif
+
+#if (SCHED_CATCHUP_POLICY == SCHED_CATCHUP_RUN_ALL)
+		if (pendingActivations[Copy_u32Runnable] < SCHED_MAX_ACTIVATIONS)
+		{
+			pendingActivations[Copy_u32Runnable]++;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+#endif
+	}
+}
+
+
+/**
+ *@brief : Function that runs all the ready runnables of a level, in the order of "arrayOfRunnables".
+ *@param : The level.
+ *@return: void.
+ */
+static void SCHED_serveLevel(uint32_t Copy_u32Level)
+{
+	volatile uint32_t* LOC_Pu32Ready = readyRunnables[Copy_u32Level];
+	uint32_t LOC_u32Word = 0;
+	uint32_t LOC_u32Runnable;
+
+	while (LOC_u32Word < SCHED_WHEEL_WORDS)
+	{
+		if (LOC_Pu32Ready[LOC_u32Word] == 0)
+		{
+			LOC_u32Word++;
+		}
+		else
+		{
+			LOC_u32Runnable = (LOC_u32Word * SCHED_BITS_PER_WORD) + (uint32_t)__builtin_ctzl(LOC_Pu32Ready[LOC_u32Word]);
+
+			SCHED_runRunnable(LOC_u32Runnable);
+
+			/* The SysTick handler changes the same data, and a runnable removed while it was running
+			 * has no activations left */
+			CPU_DisableInterrupts();
+			if (pendingActivations[LOC_u32Runnable] != 0)
+			{
+				pendingActivations[LOC_u32Runnable]--;
+			}
+			else
+			{
+				/* Do Nothing */
+			}
+			if (pendingActivations[LOC_u32Runnable] == 0)
+			{
+				LOC_Pu32Ready[LOC_u32Word] &= ~(1UL << (LOC_u32Runnable % SCHED_BITS_PER_WORD));
+			}
+			else
+			{
+				/* Do Nothing */
+			}
+			CPU_EnableInterrupts();
+
+			/* A runnable before this one may be released while it was running, so start again */
+			LOC_u32Word = 0;
+		}
+	}
+}
+
+
+/**
+ *@brief : Function that checks whether a level has ready runnables or not.
+ *@param : The level.
+ *@return: 1 if there is any ready runnable, 0 otherwise.
+ */
+static inline uint32_t SCHED_isLevelReady(uint32_t Copy_u32Level)
+{
+	uint32_t LOC_u32Word;
+	uint32_t LOC_u32Ready = 0;
+
+	for (LOC_u32Word = 0; LOC_u32Word < SCHED_WHEEL_WORDS; LOC_u32Word++)
+	{
+		LOC_u32Ready |= readyRunnables[Copy_u32Level][LOC_u32Word];
+	}
+
+	return (LOC_u32Ready != 0);
+}
+#endif
+
+
+/**
+ *@brief : Function that takes the events posted until now from the queue and runs their runnables,
+ * 			in preemptive mode it makes them ready at their levels instead.
+ *@param : void.
+ *@return: void.
+ */
+static void SCHED_dispatchEvents(void)
+{
+	/* The events posted while dispatching wait for the next time, so a flood of events can't hold
+	 * the scheduler here */
+	uint32_t LOC_u32Head = eventHead;
+	uint32_t LOC_u32Tail = eventTail;
+	uint32_t LOC_u32Runnable;
+	const runnable_t* LOC_pstrRunnable;
+#if ((SCHED_PROFILING_MODE == SCHED_PROFILING_ENABLE) && (SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_DISABLE))
+	uint32_t LOC_u32Start = DWT_u32GetCycleCount();
+	uint32_t LOC_u32First = LOC_u32Tail;
+#endif
+
+	while (LOC_u32Tail != LOC_u32Head)
+	{
+		LOC_u32Runnable = eventQueue[LOC_u32Tail & SCHED_EVENT_QUEUE_MASK];
+		LOC_u32Tail++;
+		/* Free the slot before running, so the runnable itself can post again */
+		eventTail = LOC_u32Tail;
+
+		/* A free dynamic slot has no call back */
+		LOC_pstrRunnable = SCHED_getRunnable(LOC_u32Runnable);
+		if ((LOC_pstrRunnable->activation == SCHED_ACTIVATION_EVENT) && (LOC_pstrRunnable->callBackFn != NULL_PTR) &&
+			(SCHED_IS_IN_MODE(LOC_u32Runnable) != 0))
+		{
+#if (SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_ENABLE)
+			/* The SysTick handler changes the same data */
+			CPU_DisableInterrupts();
+			SCHED_activateRunnable(LOC_u32Runnable);
+			CPU_EnableInterrupts();
+#else
+			SCHED_runRunnable(LOC_u32Runnable);
+#endif
+		}
+		else
+		{
+			/* Do Nothing, the event doesn't belong to an event runnable of the current mode */
+		}
+	}
+
+#if ((SCHED_PROFILING_MODE == SCHED_PROFILING_ENABLE) && (SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_DISABLE))
+	/* The events are run outside the ticks, add them to the CPU load (but not the empty checks) */
+	if (LOC_u32Head != LOC_u32First)
+	{
+		busyCycles += DWT_u32GetCycleCount() - LOC_u32Start;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+#endif
+}
+
+
+#if (SCHED_CYCLIC_EXECUTIVE_MODE == SCHED_CYCLIC_EXECUTIVE_DISABLE)
+#if (SCHED_DISPATCH_POLICY == SCHED_DISPATCH_EDF)
+/**
+ *@brief : Function that compares the deadlines of two waiting runnables.
+ *@param : Index of the first runnable.
+ *@param : Index of the second runnable.
+ *@return: 1 if the first one runs before the second one, 0 otherwise.
+ */
+static inline uint32_t SCHED_isEarlier(uint32_t Copy_u32First, uint32_t Copy_u32Second)
+{
+	/* The deadlines wrap around with the ticks, and the equal ones keep the order of "arrayOfRunnables" */
+	sint32_t LOC_s32Difference = (sint32_t)(arrayOfRunnablesCtrl[Copy_u32First].deadline - arrayOfRunnablesCtrl[Copy_u32Second].deadline);
+
+	return ((LOC_s32Difference < 0) || ((LOC_s32Difference == 0) && (Copy_u32First < Copy_u32Second)));
+}
+
+
+/**
+ *@brief : Function that moves the runnable at a position of the heap up or down until its parent is
+ * 			earlier and its children are later.
+ *@param : The position in the heap.
+ *@return: void.
+ */
+static void SCHED_placeInHeap(uint32_t Copy_u32Position)
+{
+	uint32_t LOC_u32Runnable = readyHeap[Copy_u32Position];
+	/* A heap of one runnable is always in order */
+#if (SCHED_RUNNABLES_CAPACITY > 1)
+	uint32_t LOC_u32Other;
+	uint32_t LOC_u32Done = 0;
+
+	while ((Copy_u32Position > 0) && (SCHED_isEarlier(LOC_u32Runnable, readyHeap[(Copy_u32Position - 1) / 2]) != 0))
+	{
+		readyHeap[Copy_u32Position] = readyHeap[(Copy_u32Position - 1) / 2];
+		heapPosition[readyHeap[Copy_u32Position]] = (uint16_t)(Copy_u32Position + 1);
+		Copy_u32Position = (Copy_u32Position - 1) / 2;
+	}
+
+	while (LOC_u32Done == 0)
+	{
+		/* The earlier child, if there is any */
+		LOC_u32Other = (2 * Copy_u32Position) + 1;
+		if (((LOC_u32Other + 1) < readyHeapSize) && (SCHED_isEarlier(readyHeap[LOC_u32Other + 1], readyHeap[LOC_u32Other]) != 0))
+		{
+			LOC_u32Other++;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+
+		if ((LOC_u32Other < readyHeapSize) && (SCHED_isEarlier(readyHeap[LOC_u32Other], LOC_u32Runnable) != 0))
+		{
+			readyHeap[Copy_u32Position] = readyHeap[LOC_u32Other];
+			heapPosition[readyHeap[Copy_u32Position]] = (uint16_t)(Copy_u32Position + 1);
+			Copy_u32Position = LOC_u32Other;
+		}
+		else
+		{
+			LOC_u32Done = 1;
+		}
+	}
+#endif
+
+	readyHeap[Copy_u32Position] = (uint16_t)LOC_u32Runnable;
+	heapPosition[LOC_u32Runnable] = (uint16_t)(Copy_u32Position + 1);
+}
+
+
+/**
+ *@brief : Function that takes a waiting runnable out of the heap.
+ *@param : Index of the runnable, it must be waiting.
+ *@return: void.
+ */
+static void SCHED_removeFromHeap(uint32_t Copy_u32Runnable)
+{
+	uint32_t LOC_u32Position = heapPosition[Copy_u32Runnable] - 1;
+
+	heapPosition[Copy_u32Runnable] = 0;
+	readyHeapSize--;
+
+	/* The last one takes its place */
+	if (LOC_u32Position != readyHeapSize)
+	{
+		readyHeap[LOC_u32Position] = readyHeap[readyHeapSize];
+		SCHED_placeInHeap(LOC_u32Position);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+#endif
+
+
+/**
+ *@brief : Function that serves a release of a runnable at the current tick as SCHED_DISPATCH_POLICY says,
+ * 			it runs now or waits in the heap for its deadline's turn.
+ *@param : Index of the runnable in "arrayOfRunnablesCtrl".
+ *@return: void.
+ */
+static inline void SCHED_serveRelease(uint32_t Copy_u32Runnable)
+{
+#if (SCHED_DISPATCH_POLICY == SCHED_DISPATCH_EDF)
+	if (heapPosition[Copy_u32Runnable] == 0)
+	{
+		arrayOfRunnablesCtrl[Copy_u32Runnable].releaseTick = timeStamp;
+		arrayOfRunnablesCtrl[Copy_u32Runnable].deadline = timeStamp + arrayOfRunnablesCtrl[Copy_u32Runnable].periodTicks;
+		readyHeap[readyHeapSize] = (uint16_t)Copy_u32Runnable;
+		readyHeapSize++;
+		SCHED_placeInHeap(readyHeapSize - 1);
+	}
+	else
+	{
+		/* The previous release is still waiting and its deadline has come, it's merged into this one */
+#if (SCHED_TIMING_HEALTH_MODE == SCHED_TIMING_HEALTH_ENABLE)
+		timingHealth.runnables[Copy_u32Runnable].deadlineMisses++;
+#endif
+	}
+#else
+	SCHED_runRunnable(Copy_u32Runnable);
+#endif
+}
+
+
+/**
+ *@brief : Function that handles a release at the current tick which is already passed, as
+ * 			SCHED_CATCHUP_POLICY says.
+ *@param : Index of the runnable in "arrayOfRunnables".
+ *@param : The last tick that has ended.
+ *@return: void.
+ */
+static void SCHED_handleLateRelease(uint32_t Copy_u32Runnable, uint32_t Copy_u32Now)
+{
+#if (SCHED_CATCHUP_POLICY == SCHED_CATCHUP_RUN_ALL)
+	/* Every release runs, so how late it is doesn't matter */
+	(void)Copy_u32Now;
+
+#if (SCHED_TIMING_HEALTH_MODE == SCHED_TIMING_HEALTH_ENABLE)
+	timingHealth.runnables[Copy_u32Runnable].deadlineMisses++;
+#endif
+
+	SCHED_serveRelease(Copy_u32Runnable);
+	SCHED_advanceRelease(Copy_u32Runnable);
+#else
+	SCHED_strRunnableCtrl_t* LOC_pstrCtrl = &arrayOfRunnablesCtrl[Copy_u32Runnable];
+
+	/* Number of releases of this runnable from the current tick until (not including) now, all of
+	 * them are passed */
+	uint32_t LOC_u32Missed = ((Copy_u32Now - timeStamp) + LOC_pstrCtrl->periodTicks - 1) / LOC_pstrCtrl->periodTicks;
+
+#if (SCHED_TIMING_HEALTH_MODE == SCHED_TIMING_HEALTH_ENABLE)
+	timingHealth.runnables[Copy_u32Runnable].deadlineMisses += LOC_u32Missed;
+#endif
+
+	/* Move to the first release that is not passed, so the runnable keeps its phase */
+	LOC_pstrCtrl->nextRelease = timeStamp + (LOC_u32Missed * LOC_pstrCtrl->periodTicks);
+
+#if (SCHED_CATCHUP_POLICY == SCHED_CATCHUP_COALESCE)
+	/* Run once for all the missed releases, if the first release that is not passed is now it runs
+	 * there instead */
+	if (LOC_pstrCtrl->nextRelease != Copy_u32Now)
+	{
+		SCHED_serveRelease(Copy_u32Runnable);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+#endif
+#endif
+}
+
+
+#if (SCHED_TICKLESS_MODE == SCHED_TICKLESS_ENABLE)
+/**
+ *@brief : Function that jumps over the ticks in which no runnable is released without visiting the wheel.
+ *@param : Number of ticks ended until now.
+ *@return: void.
+ */
+static void SCHED_skipIdleTicks(uint32_t Copy_u32TickCount)
+{
+	uint32_t LOC_u32Distance = SCHED_ticksToNextRelease();
+
+	if (LOC_u32Distance > (Copy_u32TickCount - timeStamp))
+	{
+		LOC_u32Distance = Copy_u32TickCount - timeStamp;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	timeStamp += LOC_u32Distance;
+}
+#endif
+
+
+/**
+ *@brief : Function that runs the runnables released at the current tick.
+ *@param : The last tick that has ended, if the current tick is before it the releases are late.
+ *@return: void.
+ */
+static void SCHED_sched(uint32_t Copy_u32Now)
+{
+	uint32_t* LOC_Pu32Slot = timingWheel[timeStamp & SCHED_WHEEL_MASK];
+	uint32_t LOC_u32Word;
+	uint32_t LOC_u32Bits;
+	uint32_t LOC_u32Runnable;
+#if (SCHED_PROFILING_MODE == SCHED_PROFILING_ENABLE)
+	uint32_t LOC_u32TickStart = DWT_u32GetCycleCount();
+#endif
+
+#if (SCHED_MULTI_MODE == SCHED_MULTI_MODE_ENABLE)
+	/* Every release of a mode within the past "modeRebaseTicks" is passed, so the mode can start from there */
+	if ((timeStamp - modeStart) >= modeRebaseTicks)
+	{
+		modeStart += modeRebaseTicks;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	/* The switch is done at a hyperperiod boundary, before any runnable is released at it */
+	if ((requestedMode != currentMode) && (SCHED_ticksToModeBoundary() == 0))
+	{
+		SCHED_enterMode(requestedMode);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+#endif
+
+	for (LOC_u32Word = 0; LOC_u32Word < SCHED_WHEEL_WORDS; LOC_u32Word++)
+	{
+		/* Take the runnables of this slot out of the wheel, the ones that are not due yet and the ones
+		 * that run now will be set again in the slot of their next release */
+		LOC_u32Bits = LOC_Pu32Slot[LOC_u32Word];
+		LOC_Pu32Slot[LOC_u32Word] = 0;
+
+		while (LOC_u32Bits != 0)
+		{
+			/* Lowest set bit first (count trailing zeros is RBIT + CLZ on the Cortex-M4) */
+			LOC_u32Runnable = (LOC_u32Word * SCHED_BITS_PER_WORD) + (uint32_t)__builtin_ctzl(LOC_u32Bits);
+			LOC_u32Bits &= (LOC_u32Bits - 1);
+
+			/* The slot is shared by all the ticks that are one wheel revolution apart, so check that the
+			 * time of this runnable really comes */
+#if (SCHED_DYNAMIC_SLOTS > 0)
+			if (arrayOfRunnablesCtrl[LOC_u32Runnable].periodTicks == 0)
+			{
+				/* Do Nothing, it was removed while this tick was processed */
+			}
+			else if (arrayOfRunnablesCtrl[LOC_u32Runnable].nextRelease != timeStamp)
+#else
+			if (arrayOfRunnablesCtrl[LOC_u32Runnable].nextRelease != timeStamp)
+#endif
+			{
+				/* Do Nothing */
+			}
+			else if (timeStamp == Copy_u32Now)
+			{
+#if (SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_ENABLE)
+				/* The runnable runs later at its level */
+				SCHED_activateRunnable(LOC_u32Runnable);
+#else
+				/* If everything is OK, call the CallBackFn of this runnable (or let it wait for its turn) */
+				SCHED_serveRelease(LOC_u32Runnable);
+#endif
+				SCHED_advanceRelease(LOC_u32Runnable);
+			}
+			else
+			{
+				SCHED_handleLateRelease(LOC_u32Runnable, Copy_u32Now);
+			}
+
+#if (SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_DISABLE)
+			/* A runnable that went to sleep isn't released until its sleep ends, and its period goes
+			 * on from there */
+			if (arrayOfRunnablesCtrl[LOC_u32Runnable].sleepTicks != 0)
+			{
+				arrayOfRunnablesCtrl[LOC_u32Runnable].nextRelease = Copy_u32Now + arrayOfRunnablesCtrl[LOC_u32Runnable].sleepTicks;
+				arrayOfRunnablesCtrl[LOC_u32Runnable].sleepTicks = 0;
+			}
+			else
+			{
+				/* Do Nothing */
+			}
+#endif
+
+#if (SCHED_DYNAMIC_SLOTS > 0)
+			/* A runnable removed while this tick was processed doesn't get in the wheel again */
+			if (arrayOfRunnablesCtrl[LOC_u32Runnable].periodTicks != 0)
+			{
+				SCHED_insertInWheel(LOC_u32Runnable);
+			}
+			else
+			{
+				/* Do Nothing */
+			}
+#else
+			SCHED_insertInWheel(LOC_u32Runnable);
+#endif
+		}
+	}
+
+#if (SCHED_PROFILING_MODE == SCHED_PROFILING_ENABLE)
+	SCHED_profileTick(LOC_u32TickStart);
+#endif
+
+	/* Move to the next tick because when this function be called next time, the time passed will be
+	 * equal to the scheduler's periodicity */
+	timeStamp++;
+}
+#else
+/**
+ *@brief : Function that runs the call backs listed in the current frame of the cyclic table and moves
+ * 			to the next frame, called inside the SysTick handler.
+ *@param : void.
+ *@return: void.
+ */
+static inline void SCHED_runFrame(void)
+{
+	const runnableCB_t* LOC_pCallBack = SCHED_cyclicTable[cyclicFrame];
+#if (SCHED_PROFILING_MODE == SCHED_PROFILING_ENABLE)
+	uint32_t LOC_u32FrameStart = DWT_u32GetCycleCount();
+#endif
+
+	while (*LOC_pCallBack != NULL_PTR)
+	{
+		(*LOC_pCallBack)();
+		LOC_pCallBack++;
+	}
+
+	cyclicFrame++;
+	if (cyclicFrame == SCHED_cyclicFramesNumber)
+	{
+		cyclicFrame = 0;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+#if (SCHED_PROFILING_MODE == SCHED_PROFILING_ENABLE)
+	SCHED_profileTick(LOC_u32FrameStart);
+#endif
+}
+#endif
+
+
+#if ((SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_DISABLE) && (SCHED_CYCLIC_EXECUTIVE_MODE == SCHED_CYCLIC_EXECUTIVE_DISABLE))
+/**
+ *@brief : Function that processes all the ticks from the current one until the last ended tick.
+ *@param : Number of ticks ended until now.
+ *@return: void.
+ */
+static void SCHED_runPendingTicks(uint32_t Copy_u32TickCount)
+{
+	uint32_t LOC_u32Now = Copy_u32TickCount - 1;
+
+#if (SCHED_TICKLESS_MODE == SCHED_TICKLESS_ENABLE)
+	SCHED_skipIdleTicks(Copy_u32TickCount);
+#endif
+
+#if (SCHED_TIMING_HEALTH_MODE == SCHED_TIMING_HEALTH_ENABLE)
+	/* If the first tick to process is not the last ended one, the main loop is behind */
+	if (timeStamp != Copy_u32TickCount)
+	{
+		SCHED_recordBacklog(LOC_u32Now - timeStamp);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+#endif
+
+	while (timeStamp != Copy_u32TickCount)
+	{
+		SCHED_sched(LOC_u32Now);
+
+#if (SCHED_TICKLESS_MODE == SCHED_TICKLESS_ENABLE)
+		SCHED_skipIdleTicks(Copy_u32TickCount);
+#endif
+	}
+}
+#endif
+
+
+#if (SCHED_DISPATCH_POLICY == SCHED_DISPATCH_EDF)
+/**
+ *@brief : Function that runs the waiting runnables, the earliest deadline first, until none is waiting.
+ * 			The ticks that end meanwhile are processed between the runs.
+ *@param : void.
+ *@return: void.
+ */
+static void SCHED_runReadyHeap(void)
+{
+	uint32_t LOC_u32Runnable;
+	uint32_t LOC_u32TickCount;
+#if (SCHED_PROFILING_MODE == SCHED_PROFILING_ENABLE)
+	uint32_t LOC_u32Start;
+#endif
+
+	while (readyHeapSize != 0)
+	{
+		LOC_u32Runnable = readyHeap[0];
+		SCHED_removeFromHeap(LOC_u32Runnable);
+
+#if (SCHED_PROFILING_MODE == SCHED_PROFILING_ENABLE)
+		/* The runs are outside the ticks, add them to the CPU load */
+		LOC_u32Start = DWT_u32GetCycleCount();
+		SCHED_runRunnable(LOC_u32Runnable);
+		busyCycles += DWT_u32GetCycleCount() - LOC_u32Start;
+#else
+		SCHED_runRunnable(LOC_u32Runnable);
+#endif
+
+		/* A runnable that went to sleep isn't released until its sleep ends, as in SCHED_sched but
+		 * from the last tick processed */
+		if (arrayOfRunnablesCtrl[LOC_u32Runnable].sleepTicks != 0)
+		{
+			SCHED_removeFromWheel(LOC_u32Runnable);
+			arrayOfRunnablesCtrl[LOC_u32Runnable].nextRelease = (timeStamp - 1) + arrayOfRunnablesCtrl[LOC_u32Runnable].sleepTicks;
+			arrayOfRunnablesCtrl[LOC_u32Runnable].sleepTicks = 0;
+			SCHED_insertInWheel(LOC_u32Runnable);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+
+		/* The ticks that ended while it was running may release earlier deadlines */
+		LOC_u32TickCount = SCHED_getTickCount();
+		if (LOC_u32TickCount != timeStamp)
+		{
+			SCHED_runPendingTicks(LOC_u32TickCount);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+}
+#endif
+
+
+
+/****************************************************************************************/
+/*								Functions' Implementation								*/
+/****************************************************************************************/
+
+
+/**
+ *@brief : Function that is called by the SysTick every scheduler's tick.
+ *@param : void.
+ *@return: void.
+ */
+void tickCallBack(void)
+{
+#if (SCHED_TIMING_HEALTH_MODE == SCHED_TIMING_HEALTH_ENABLE)
+	tickEndCycles = DWT_u32GetCycleCount();
+#endif
+
+#if (SCHED_TRACE_MODE == SCHED_TRACE_ENABLE)
+	SCHED_writeTrace(SCHED_TRACE_ISR_BEGIN, SCHED_TRACE_TICK_ISR);
+#endif
+
+#if (SCHED_TICKLESS_MODE == SCHED_TICKLESS_ENABLE)
+	uint32_t LOC_u32NextPeriod;
+
+	/* The running period has just ended, so count its ticks */
+	tickCount += runningPeriodTicks;
+
+	/* The SysTick has already reloaded the loaded period, it's the running one now */
+	runningPeriodTicks = loadedPeriodTicks;
+
+	/* Choose the period that comes after the running one, it ends at the wake up tick that the main loop
+	 * asked for. If that tick is already passed (the main loop is still busy) tick normally */
+	LOC_u32NextPeriod = nextWakeUpTick - (tickCount + runningPeriodTicks);
+	if (((sint32_t)LOC_u32NextPeriod <= 0))
+	{
+		LOC_u32NextPeriod = 1;
+	}
+	else if (LOC_u32NextPeriod > SCHED_TICKLESS_MAX_SLEEP_TICKS)
+	{
+		LOC_u32NextPeriod = SCHED_TICKLESS_MAX_SLEEP_TICKS;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	/* Writing the SysTick load value doesn't affect the running period, it's used at the next reload.
+	 * If the time base refuses the period it still has the old one loaded, so keep counting that one */
+	if ((LOC_u32NextPeriod != loadedPeriodTicks) && (SCHED_setTimeBasePeriod(LOC_u32NextPeriod) == SCHED_enuOk))
+	{
+		loadedPeriodTicks = LOC_u32NextPeriod;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+#else
+	tickCount++;
+#endif
+
+#if (SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_ENABLE)
+	/* The releases are done here so a long runnable can't delay them, the SysTick handler is never behind */
+	SCHED_sched(timeStamp);
+#elif (SCHED_CYCLIC_EXECUTIVE_MODE == SCHED_CYCLIC_EXECUTIVE_ENABLE)
+	SCHED_runFrame();
+#endif
+
+#if (SCHED_TRACE_MODE == SCHED_TRACE_ENABLE)
+	SCHED_writeTrace(SCHED_TRACE_ISR_END, SCHED_TRACE_TICK_ISR);
+#endif
+}
+
+
+#if (SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_ENABLE)
+/**
+ *@brief : The PendSV handler, it runs the runnables of priority 1.
+ *@param : void.
+ *@return: void.
+ */
+void PendSV_Handler(void)
+{
+#if (SCHED_PREEMPTIVE_LEVELS == 1)
+	SCHED_dispatchEvents();
+#endif
+	SCHED_serveLevel(1);
+}
+
+
+#if (SCHED_PREEMPTIVE_LEVELS >= 2)
+/**
+ *@brief : The handler of SCHED_PRIORITY_2_IRQ, it runs the runnables of priority 2.
+ *@param : void.
+ *@return: void.
+ */
+void SCHED_PRIORITY_2_IRQ_HANDLER(void)
+{
+#if (SCHED_PREEMPTIVE_LEVELS == 2)
+	SCHED_dispatchEvents();
+#endif
+	SCHED_serveLevel(2);
+}
+#endif
+
+
+#if (SCHED_PREEMPTIVE_LEVELS >= 3)
+/**
+ *@brief : The handler of SCHED_PRIORITY_3_IRQ, it runs the runnables of priority 3.
+ *@param : void.
+ *@return: void.
+ */
+void SCHED_PRIORITY_3_IRQ_HANDLER(void)
+{
+#if (SCHED_PREEMPTIVE_LEVELS == 3)
+	SCHED_dispatchEvents();
+#endif
+	SCHED_serveLevel(3);
+}
+#endif
+
+
+#if (SCHED_PREEMPTIVE_LEVELS >= 4)
+/**
+ *@brief : The handler of SCHED_PRIORITY_4_IRQ, it runs the runnables of priority 4.
+ *@param : void.
+ *@return: void.
+ */
+void SCHED_PRIORITY_4_IRQ_HANDLER(void)
+{
+#if (SCHED_PREEMPTIVE_LEVELS == 4)
+	SCHED_dispatchEvents();
+#endif
+	SCHED_serveLevel(4);
+}
+#endif
+#endif
+
+
+/**
+ *@brief : Function that initializes the scheduler.
+ *@param : void.
+ *@return: Error status.
+ */
+SCHED_enuErrorStatus_t SCHED_init(void)
+{
+	SCHED_enuErrorStatus_t LOC_enuErrorStatus = SCHED_enuOk;
+	uint32_t LOC_u32Index;
+#if (SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_ENABLE)
+	NVIC_enuErrorStatus_t LOC_enuNVICStatus;
+#endif
+
+	for (LOC_u32Index = 0; LOC_u32Index < _RunnablesNumber_; LOC_u32Index++)
+	{
+		arrayOfRunnablesCtrl[LOC_u32Index].periodTicks = SCHED_getPeriodTicks(LOC_u32Index);
+		arrayOfRunnablesCtrl[LOC_u32Index].nextRelease = arrayOfRunnables[LOC_u32Index].firstDelayUS / SCHED_TICK_US;
+
+#if (SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_ENABLE)
+		/* A priority above the highest one runs at the highest one */
+		if (arrayOfRunnables[LOC_u32Index].priority > SCHED_PREEMPTIVE_LEVELS)
+		{
+			arrayOfRunnablesCtrl[LOC_u32Index].level = SCHED_PREEMPTIVE_LEVELS;
+		}
+		else
+		{
+			arrayOfRunnablesCtrl[LOC_u32Index].level = arrayOfRunnables[LOC_u32Index].priority;
+		}
+#endif
+
+#if ((SCHED_CYCLIC_EXECUTIVE_MODE == SCHED_CYCLIC_EXECUTIVE_DISABLE) && (SCHED_MULTI_MODE == SCHED_MULTI_MODE_DISABLE))
+		/* A runnable with a zero period never gets in the wheel, so it costs nothing at run time */
+		if (arrayOfRunnablesCtrl[LOC_u32Index].periodTicks != 0)
+		{
+			SCHED_insertInWheel(LOC_u32Index);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+#endif
+	}
+
+#if (SCHED_DYNAMIC_SLOTS > 0)
+	/* All the dynamic slots are free */
+	for (LOC_u32Index = 0; LOC_u32Index < SCHED_DYNAMIC_SLOTS; LOC_u32Index++)
+	{
+		freeSlots[LOC_u32Index / SCHED_BITS_PER_WORD] |= (1UL << (LOC_u32Index % SCHED_BITS_PER_WORD));
+	}
+#endif
+
+#if (SCHED_MULTI_MODE == SCHED_MULTI_MODE_ENABLE)
+	/* The scheduler starts in the first mode, only its runnables get in the wheel */
+	SCHED_enterMode(0);
+#endif
+
+#if ((SCHED_PROFILING_MODE == SCHED_PROFILING_ENABLE) || (SCHED_TIMING_HEALTH_MODE == SCHED_TIMING_HEALTH_ENABLE) ||\
+	 (SCHED_TRACE_MODE == SCHED_TRACE_ENABLE))
+	DWT_enuInit();
+#endif
+
+#if (SCHED_TRACE_MODE == SCHED_TRACE_ENABLE)
+	schedTrace.magic = SCHED_TRACE_MAGIC;
+	schedTrace.recordsNumber = SCHED_TRACE_RECORDS;
+	schedTrace.cyclesPerUs = AHB_CLOCK_SOURCE_VALUE / 1000000UL;
+	schedTrace.head = 0;
+	schedTrace.recording = 1;
+#endif
+
+#if (SCHED_PROFILING_MODE == SCHED_PROFILING_ENABLE)
+	SCHED_resetStats();
+#endif
+
+#if (SCHED_TIMING_HEALTH_MODE == SCHED_TIMING_HEALTH_ENABLE)
+	SCHED_resetHealth();
+#endif
+
+#if (SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_ENABLE)
+	/* The priorities are preemption levels and SCHED_lockCeiling writes them in BASEPRI as they are, so all
+	 * the four implemented bits go to the group priority */
+	LOC_enuNVICStatus = NVIC_SetPriorityGrouping(PG_GPB_7_TO_4_SPB_NONE_MASK);
+
+	/* Priority 1 is the PendSV at the lowest level, each higher priority is one level above and the SysTick
+	 * is above all of them */
+	if (LOC_enuNVICStatus == NVIC_enuOk)
+	{
+		LOC_enuNVICStatus = NVIC_SetPrioritySystemHandler(SYSTEM_HANDLER_PENDSV, SCHED_LOWEST_PREEMPTION_LEVEL, SUBPRIORITY_LEVEL_0);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+#if (SCHED_PREEMPTIVE_LEVELS >= 2)
+	for (LOC_u32Index = 2; (LOC_u32Index <= SCHED_PREEMPTIVE_LEVELS) && (LOC_enuNVICStatus == NVIC_enuOk); LOC_u32Index++)
+	{
+		LOC_enuNVICStatus = NVIC_SetPriorityIRQ(arrayOfLevelsIRQ[LOC_u32Index - 2], SCHED_LOWEST_PREEMPTION_LEVEL - (LOC_u32Index - 1), SUBPRIORITY_LEVEL_0);
+		if (LOC_enuNVICStatus == NVIC_enuOk)
+		{
+			LOC_enuNVICStatus = NVIC_EnableIRQ(arrayOfLevelsIRQ[LOC_u32Index - 2]);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+#endif
+	if (LOC_enuNVICStatus == NVIC_enuOk)
+	{
+#if (SCHED_TIME_BASE != SCHED_TIME_BASE_SYSTICK)
+		LOC_enuNVICStatus = NVIC_SetPriorityIRQ(SCHED_TIMER_IRQ, SCHED_LOWEST_PREEMPTION_LEVEL - SCHED_PREEMPTIVE_LEVELS, SUBPRIORITY_LEVEL_0);
+#else
+		LOC_enuNVICStatus = NVIC_SetPrioritySystemHandler(SYSTEM_HANDLER_SYSTICK, SCHED_LOWEST_PREEMPTION_LEVEL - SCHED_PREEMPTIVE_LEVELS, SUBPRIORITY_LEVEL_0);
+#endif
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	if (LOC_enuNVICStatus != NVIC_enuOk)
+	{
+		LOC_enuErrorStatus = SCHED_enuNotOk;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+#endif
+
+#if (SCHED_TIME_BASE != SCHED_TIME_BASE_SYSTICK)
+	TIM_enuInit(SCHED_TIMER);
+	TIM_enuSetCallBack(SCHED_TIMER, tickCallBack);
+	if (NVIC_EnableIRQ(SCHED_TIMER_IRQ) != NVIC_enuOk)
+	{
+		LOC_enuErrorStatus = SCHED_enuNotOk;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+#else
+	SYSTICK_Subscribe(tickCallBack, 1, SCHED_SYSTICK_PRIORITY);
+#endif
+	if (SCHED_setTimeBasePeriod(1) != SCHED_enuOk)
+	{
+		LOC_enuErrorStatus = SCHED_enuNotOk;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	return LOC_enuErrorStatus;
+}
+
+
+/**
+ *@brief : Function that starts the scheduler.
+ *@param : void.
+ *@return: void.
+ */
+void SCHED_start(void)
+{
+#if (SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_ENABLE)
+#if (SCHED_PROFILING_MODE == SCHED_PROFILING_ENABLE)
+	uint32_t LOC_u32SleepStart;
+#endif
+
+	SCHED_startTimeBase();
+	while (1)
+	{
+		/* The main loop runs the runnables of priority zero, the others preempt it */
+		SCHED_serveLevel(0);
+
+		/* Sleep until the next interrupt, the interrupts are masked so a release can't come between
+		 * the check and the sleep, a pending interrupt still wakes the core up from WFI */
+		CPU_DisableInterrupts();
+		if (SCHED_isLevelReady(0) == 0)
+		{
+#if (SCHED_PROFILING_MODE == SCHED_PROFILING_ENABLE)
+			LOC_u32SleepStart = DWT_u32GetCycleCount();
+			CPU_WaitForInterrupt();
+			idleCycles += DWT_u32GetCycleCount() - LOC_u32SleepStart;
+#else
+			CPU_WaitForInterrupt();
+#endif
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+		CPU_EnableInterrupts();
+	}
+#elif (SCHED_CYCLIC_EXECUTIVE_MODE == SCHED_CYCLIC_EXECUTIVE_ENABLE)
+	SCHED_startTimeBase();
+	while (1)
+	{
+		/* The frames run in the SysTick handler, the main loop only runs the event runnables */
+		SCHED_dispatchEvents();
+
+		/* The interrupts are masked so no event can be posted between checking and sleeping */
+		CPU_DisableInterrupts();
+		if (eventHead == eventTail)
+		{
+			CPU_WaitForInterrupt();
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+		CPU_EnableInterrupts();
+	}
+#else
+	uint32_t LOC_u32TickCount;
+#if (SCHED_TICKLESS_MODE == SCHED_TICKLESS_ENABLE)
+	uint32_t LOC_u32Distance;
+#endif
+
+	SCHED_startTimeBase();
+	while (1)
+	{
+		/* Catch up with all the ticks counted by the SysTick handler */
+		LOC_u32TickCount = SCHED_getTickCount();
+		if (LOC_u32TickCount != timeStamp)
+		{
+			SCHED_runPendingTicks(LOC_u32TickCount);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+
+#if (SCHED_DISPATCH_POLICY == SCHED_DISPATCH_EDF)
+		SCHED_runReadyHeap();
+#endif
+
+		SCHED_dispatchEvents();
+
+#if (SCHED_TICKLESS_MODE == SCHED_TICKLESS_ENABLE)
+		/* The tick of a release is processed when the SysTick ends it, so wake up one tick after it.
+		 * The interrupts are masked so the SysTick can't end a period and no event can be posted
+		 * between checking and sleeping, a pending interrupt still wakes the core up from WFI */
+		LOC_u32Distance = SCHED_ticksToNextRelease();
+		CPU_DisableInterrupts();
+		nextWakeUpTick = timeStamp + LOC_u32Distance + 1;
+		if ((tickCount == timeStamp) && (eventHead == eventTail))
+		{
+			CPU_WaitForInterrupt();
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+		CPU_EnableInterrupts();
+#endif
+	}
+#endif
+}
+
+
+/**
+ *@brief : Function that releases an event runnable, it runs on the next iteration of the scheduler.
+ * 			It's safe to call from an interrupt, but all the callers must have the same preemption
+ * 			level as the queue has a single producer.
+ *@param : The event, the index of the runnable in "arrayOfRunnables" or given by SCHED_addRunnable.
+ *@return: Error status.
+ */
+SCHED_enuErrorStatus_t SCHED_postEvent(RunnablesList_t Copy_enuEvent)
+{
+	SCHED_enuErrorStatus_t LOC_enuErrorStatus = SCHED_enuOk;
+	uint32_t LOC_u32Head = eventHead;
+
+	if ((uint32_t)Copy_enuEvent >= SCHED_RUNNABLES_CAPACITY)
+	{
+		LOC_enuErrorStatus = SCHED_enuInvalidEvent;
+	}
+	else if ((LOC_u32Head - eventTail) >= SCHED_EVENT_QUEUE_SIZE)
+	{
+		LOC_enuErrorStatus = SCHED_enuEventQueueFull;
+	}
+	else
+	{
+		/* The event has to be in its slot before the scheduler can see the new head */
+		eventQueue[LOC_u32Head & SCHED_EVENT_QUEUE_MASK] = (uint16_t)Copy_enuEvent;
+		eventHead = LOC_u32Head + 1;
+
+#if (SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_ENABLE)
+		/* The queue is read by the highest priority so the event isn't delayed by any runnable */
+		SCHED_pendLevel(SCHED_PREEMPTIVE_LEVELS);
+#endif
+	}
+
+	return LOC_enuErrorStatus;
+}
+
+
+/**
+ *@brief : Function that gets the current time of the scheduler, the tick of the running release.
+ *@param : void.
+ *@return: The time in scheduler's ticks, it wraps around.
+ */
+uint32_t SCHED_getTime(void)
+{
+#if (SCHED_CYCLIC_EXECUTIVE_MODE == SCHED_CYCLIC_EXECUTIVE_ENABLE)
+	/* The frames don't use the time stamp, only the SysTick handler counts */
+	return tickCount;
+#else
+	return timeStamp;
+#endif
+}
+
+
+#if (SCHED_CYCLIC_EXECUTIVE_MODE == SCHED_CYCLIC_EXECUTIVE_DISABLE)
+/**
+ *@brief : Function that changes the period of a periodic runnable, the new period goes on from its
+ * 			release that is already planned.
+ *@param : Index of the runnable in "arrayOfRunnablesCtrl".
+ *@param : The new period in microseconds.
+ *@return: Error status.
+ */
+SCHED_enuErrorStatus_t SCHED_setPeriod(uint32_t Copy_u32Runnable, uint32_t Copy_u32PeriodUS)
+{
+	SCHED_enuErrorStatus_t LOC_enuErrorStatus = SCHED_enuOk;
+
+	if (Copy_u32Runnable >= SCHED_RUNNABLES_CAPACITY)
+	{
+		LOC_enuErrorStatus = SCHED_enuInvalidRunnable;
+	}
+	else if (Copy_u32PeriodUS < SCHED_TICK_US)
+	{
+		LOC_enuErrorStatus = SCHED_enuInvalidPeriod;
+	}
+	else
+	{
+		/* The scheduler and SCHED_removeRunnable may change the same runnable from an interrupt */
+		CPU_DisableInterrupts();
+
+		/* Only a runnable that is in the wheel has a period, not an event one, a free slot nor a
+		 * runnable out of the current mode */
+		if (arrayOfRunnablesCtrl[Copy_u32Runnable].periodTicks == 0)
+		{
+			LOC_enuErrorStatus = SCHED_enuInvalidRunnable;
+		}
+		else
+		{
+			arrayOfRunnablesCtrl[Copy_u32Runnable].periodTicks = Copy_u32PeriodUS / SCHED_TICK_US;
+#if (SCHED_DYNAMIC_SLOTS > 0)
+			if (Copy_u32Runnable >= _RunnablesNumber_)
+			{
+				dynamicRunnables[Copy_u32Runnable - _RunnablesNumber_].periodicityUS = Copy_u32PeriodUS;
+			}
+			else
+			{
+				/* Do Nothing, "arrayOfRunnables" is const */
+			}
+#endif
+		}
+
+		CPU_EnableInterrupts();
+	}
+
+	return LOC_enuErrorStatus;
+}
+#endif
+
+
+#if (SCHED_DYNAMIC_SLOTS > 0)
+/**
+ *@brief : Function that adds a runnable in the first free dynamic slot.
+ *@param : Pointer to the runnable, it's copied in the slot.
+ *@param : Pointer in which the index of the runnable in "arrayOfRunnablesCtrl" is assigned.
+ *@return: Error status.
+ */
+SCHED_enuErrorStatus_t SCHED_addRunnable(const runnable_t* Add_pstrRunnable, uint32_t* Add_pu32Runnable)
+{
+	SCHED_enuErrorStatus_t LOC_enuErrorStatus = SCHED_enuOk;
+	SCHED_strRunnableCtrl_t* LOC_pstrCtrl;
+	uint32_t LOC_u32Word = 0;
+	uint32_t LOC_u32Runnable;
+
+	if ((Add_pstrRunnable == NULL_PTR) || (Add_pu32Runnable == NULL_PTR) || (Add_pstrRunnable->callBackFn == NULL_PTR))
+	{
+		LOC_enuErrorStatus = SCHED_enuNullPointer;
+	}
+	else if ((Add_pstrRunnable->activation != SCHED_ACTIVATION_EVENT) && (Add_pstrRunnable->periodicityUS < SCHED_TICK_US))
+	{
+		LOC_enuErrorStatus = SCHED_enuInvalidPeriod;
+	}
+	else
+	{
+		/* The slots may be taken and freed from an interrupt too */
+		CPU_DisableInterrupts();
+
+		while ((LOC_u32Word < SCHED_DYNAMIC_WORDS) && (freeSlots[LOC_u32Word] == 0))
+		{
+			LOC_u32Word++;
+		}
+
+		if (LOC_u32Word == SCHED_DYNAMIC_WORDS)
+		{
+			LOC_enuErrorStatus = SCHED_enuNoFreeSlot;
+		}
+		else
+		{
+			LOC_u32Runnable = (LOC_u32Word * SCHED_BITS_PER_WORD) + (uint32_t)__builtin_ctzl(freeSlots[LOC_u32Word]);
+			freeSlots[LOC_u32Word] &= ~(1UL << (LOC_u32Runnable % SCHED_BITS_PER_WORD));
+
+			dynamicRunnables[LOC_u32Runnable] = *Add_pstrRunnable;
+			LOC_u32Runnable += _RunnablesNumber_;
+			LOC_pstrCtrl = &arrayOfRunnablesCtrl[LOC_u32Runnable];
+
+			/* The running tick is the one that hasn't ended yet, so the first release is never at a
+			 * tick that the scheduler has already processed or is processing now */
+			LOC_pstrCtrl->periodTicks = SCHED_getPeriodTicks(LOC_u32Runnable);
+			LOC_pstrCtrl->nextRelease = tickCount + (Add_pstrRunnable->firstDelayUS / SCHED_TICK_US);
+#if (SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_ENABLE)
+			if (Add_pstrRunnable->priority > SCHED_PREEMPTIVE_LEVELS)
+			{
+				LOC_pstrCtrl->level = SCHED_PREEMPTIVE_LEVELS;
+			}
+			else
+			{
+				LOC_pstrCtrl->level = Add_pstrRunnable->priority;
+			}
+#else
+			LOC_pstrCtrl->sleepTicks = 0;
+#endif
+
+#if (SCHED_PROFILING_MODE == SCHED_PROFILING_ENABLE)
+			SCHED_clearProfile(LOC_u32Runnable);
+#endif
+#if (SCHED_TIMING_HEALTH_MODE == SCHED_TIMING_HEALTH_ENABLE)
+			SCHED_clearHealth(LOC_u32Runnable);
+#endif
+#if (SCHED_MULTI_MODE == SCHED_MULTI_MODE_ENABLE)
+			activeRunnables[LOC_u32Runnable / SCHED_BITS_PER_WORD] |= (1UL << (LOC_u32Runnable % SCHED_BITS_PER_WORD));
+#endif
+
+			if (LOC_pstrCtrl->periodTicks != 0)
+			{
+				SCHED_insertInWheel(LOC_u32Runnable);
+			}
+			else
+			{
+				/* Do Nothing, an event runnable isn't released by time */
+			}
+
+			*Add_pu32Runnable = LOC_u32Runnable;
+		}
+
+		CPU_EnableInterrupts();
+	}
+
+	return LOC_enuErrorStatus;
+}
+
+
+/**
+ *@brief : Function that removes a runnable added by SCHED_addRunnable, it's taken out of the wheel and
+ * 			its slot is free at once.
+ *@param : Index of the runnable in "arrayOfRunnablesCtrl".
+ *@return: Error status.
+ */
+SCHED_enuErrorStatus_t SCHED_removeRunnable(uint32_t Copy_u32Runnable)
+{
+	SCHED_enuErrorStatus_t LOC_enuErrorStatus = SCHED_enuOk;
+	uint32_t LOC_u32Slot = Copy_u32Runnable - _RunnablesNumber_;
+
+	/* "arrayOfRunnables" is const, and a free slot has no call back */
+	if ((Copy_u32Runnable < _RunnablesNumber_) || (Copy_u32Runnable >= SCHED_RUNNABLES_CAPACITY))
+	{
+		LOC_enuErrorStatus = SCHED_enuInvalidRunnable;
+	}
+	else
+	{
+		CPU_DisableInterrupts();
+
+		if (dynamicRunnables[LOC_u32Slot].callBackFn == NULL_PTR)
+		{
+			LOC_enuErrorStatus = SCHED_enuInvalidRunnable;
+		}
+		else
+		{
+			/* If the scheduler is processing the tick of this runnable now, the zero period tells it
+			 * not to run it nor to put it in the wheel again */
+			if (arrayOfRunnablesCtrl[Copy_u32Runnable].periodTicks != 0)
+			{
+				SCHED_removeFromWheel(Copy_u32Runnable);
+				arrayOfRunnablesCtrl[Copy_u32Runnable].periodTicks = 0;
+			}
+			else
+			{
+				/* Do Nothing */
+			}
+
+#if (SCHED_DISPATCH_POLICY == SCHED_DISPATCH_EDF)
+			/* The release that is waiting is dropped */
+			if (heapPosition[Copy_u32Runnable] != 0)
+			{
+				SCHED_removeFromHeap(Copy_u32Runnable);
+			}
+			else
+			{
+				/* Do Nothing */
+			}
+#endif
+
+#if (SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_ENABLE)
+			/* The releases that haven't run yet are dropped */
+			pendingActivations[Copy_u32Runnable] = 0;
+			readyRunnables[arrayOfRunnablesCtrl[Copy_u32Runnable].level][Copy_u32Runnable / SCHED_BITS_PER_WORD]\
+					&= ~(1UL << (Copy_u32Runnable % SCHED_BITS_PER_WORD));
+#else
+			arrayOfRunnablesCtrl[Copy_u32Runnable].sleepTicks = 0;
+#endif
+#if (SCHED_MULTI_MODE == SCHED_MULTI_MODE_ENABLE)
+			activeRunnables[Copy_u32Runnable / SCHED_BITS_PER_WORD] &= ~(1UL << (Copy_u32Runnable % SCHED_BITS_PER_WORD));
+#endif
+
+			dynamicRunnables[LOC_u32Slot].callBackFn = NULL_PTR;
+			freeSlots[LOC_u32Slot / SCHED_BITS_PER_WORD] |= (1UL << (LOC_u32Slot % SCHED_BITS_PER_WORD));
+		}
+
+		CPU_EnableInterrupts();
+	}
+
+	return LOC_enuErrorStatus;
+}
+#endif
+
+
+#if (SCHED_MULTI_MODE == SCHED_MULTI_MODE_ENABLE)
+/**
+ *@brief : Function that asks the scheduler to switch to another mode, the switch is done at the next
+ * 			hyperperiod boundary of the current mode. It's safe to call from an interrupt, and a later
+ * 			request before the switch replaces this one.
+ *@param : The mode.
+ *@return: Error status.
+ */
+SCHED_enuErrorStatus_t SCHED_requestMode(ModesList_t Copy_enuMode)
+{
+	SCHED_enuErrorStatus_t LOC_enuErrorStatus = SCHED_enuOk;
+
+	if ((uint32_t)Copy_enuMode >= _ModesNumber_)
+	{
+		LOC_enuErrorStatus = SCHED_enuInvalidMode;
+	}
+	else
+	{
+		requestedMode = (uint32_t)Copy_enuMode;
+	}
+
+	return LOC_enuErrorStatus;
+}
+
+
+/**
+ *@brief : Function that gets the mode the scheduler runs now.
+ *@param : void.
+ *@return: The mode.
+ */
+ModesList_t SCHED_getMode(void)
+{
+	return (ModesList_t)currentMode;
+}
+#endif
+
+
+/**
+ *@brief : Function that stops releasing the running periodic runnable for a number of ticks, its next
+ * 			release is after them and its period goes on from there. It's a hint only: in preemptive and
+ * 			cyclic executive modes, and for event runnables, it does nothing and the runnable is
+ * 			released as usual, so the runnable has to check the time by itself as SCHED_CO_SLEEP does.
+ *@param : Number of ticks from the current one, zero does nothing.
+ *@return: void.
+ */
+void SCHED_sleepCurrent(uint32_t Copy_u32Ticks)
+{
+#if ((SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_DISABLE) && (SCHED_CYCLIC_EXECUTIVE_MODE == SCHED_CYCLIC_EXECUTIVE_DISABLE))
+	/* The scheduler moves the release when the runnable returns, the event runnables are not in the wheel */
+	if (arrayOfRunnablesCtrl[runningRunnable].periodTicks != 0)
+	{
+		arrayOfRunnablesCtrl[runningRunnable].sleepTicks = Copy_u32Ticks;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+#else
+	(void)Copy_u32Ticks;
+#endif
+}
+
+
+#if (SCHED_PROFILING_MODE == SCHED_PROFILING_ENABLE)
+/**
+ *@brief : Function that gets the execution time measurements of the runnables, call it from a runnable.
+ *@param : Pointer to the structure in which the measurements will be assigned.
+ *@return: Error status.
+ */
+SCHED_enuErrorStatus_t SCHED_getStats(SCHED_strStats_t* Add_pstrStats)
+{
+	SCHED_enuErrorStatus_t LOC_enuErrorStatus = SCHED_enuOk;
+	uint32_t LOC_u32Index;
+	uint64_t LOC_u64Elapsed;
+
+	if (Add_pstrStats == NULL_PTR)
+	{
+		LOC_enuErrorStatus = SCHED_enuNullPointer;
+	}
+	else
+	{
+#if (SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_ENABLE)
+		/* The handlers of the higher priorities update the measurements at any time */
+		CPU_DisableInterrupts();
+#endif
+
+		for (LOC_u32Index = 0; LOC_u32Index < SCHED_RUNNABLES_CAPACITY; LOC_u32Index++)
+		{
+			Add_pstrStats->runnables[LOC_u32Index].runsCount = arrayOfRunnablesProfile[LOC_u32Index].runsCount;
+			Add_pstrStats->runnables[LOC_u32Index].lastCycles = arrayOfRunnablesProfile[LOC_u32Index].lastCycles;
+			Add_pstrStats->runnables[LOC_u32Index].maxCycles = arrayOfRunnablesProfile[LOC_u32Index].maxCycles;
+
+			/* A runnable that has never run has no min nor mean */
+			if (arrayOfRunnablesProfile[LOC_u32Index].runsCount == 0)
+			{
+				Add_pstrStats->runnables[LOC_u32Index].minCycles = 0;
+				Add_pstrStats->runnables[LOC_u32Index].meanCycles = 0;
+			}
+			else
+			{
+				Add_pstrStats->runnables[LOC_u32Index].minCycles = arrayOfRunnablesProfile[LOC_u32Index].minCycles;
+				Add_pstrStats->runnables[LOC_u32Index].meanCycles =
+						(uint32_t)(arrayOfRunnablesProfile[LOC_u32Index].totalCycles / arrayOfRunnablesProfile[LOC_u32Index].runsCount);
+			}
+		}
+
+		Add_pstrStats->lastTickCycles = lastTickCycles;
+		Add_pstrStats->maxTickCycles = maxTickCycles;
+
+		/* The cycles passed since the end of the last tick are counted too */
+		LOC_u64Elapsed = elapsedCycles + (uint32_t)(DWT_u32GetCycleCount() - lastSampleCycles);
+		if (LOC_u64Elapsed == 0)
+		{
+			Add_pstrStats->cpuLoadPermille = 0;
+		}
+		else
+		{
+#if (SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_ENABLE)
+			/* The runnables run outside the ticks, so the load is all the time the core wasn't sleeping */
+			Add_pstrStats->cpuLoadPermille = (uint32_t)(((LOC_u64Elapsed - idleCycles) * 1000) / LOC_u64Elapsed);
+#else
+			Add_pstrStats->cpuLoadPermille = (uint32_t)((busyCycles * 1000) / LOC_u64Elapsed);
+#endif
+		}
+
+#if (SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_ENABLE)
+		CPU_EnableInterrupts();
+#endif
+	}
+
+	return LOC_enuErrorStatus;
+}
+
+
+/**
+ *@brief : Function that clears the execution time measurements and starts measuring again from now,
+ * 			call it from a runnable.
+ *@param : void.
+ *@return: void.
+ */
+void SCHED_resetStats(void)
+{
+	uint32_t LOC_u32Index;
+
+	for (LOC_u32Index = 0; LOC_u32Index < SCHED_RUNNABLES_CAPACITY; LOC_u32Index++)
+	{
+		SCHED_clearProfile(LOC_u32Index);
+	}
+
+	lastTickCycles = 0;
+	maxTickCycles = 0;
+	busyCycles = 0;
+	elapsedCycles = 0;
+	lastSampleCycles = DWT_u32GetCycleCount();
+#if (SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_ENABLE)
+	idleCycles = 0;
+#endif
+}
+#endif
+
+
+#if (SCHED_TIMING_HEALTH_MODE == SCHED_TIMING_HEALTH_ENABLE)
+/**
+ *@brief : Function that gets the timing health of the scheduler and its runnables, call it from a runnable.
+ *@param : Pointer to the structure in which the timing health will be assigned.
+ *@return: Error status.
+ */
+SCHED_enuErrorStatus_t SCHED_getHealth(SCHED_strHealth_t* Add_pstrHealth)
+{
+	SCHED_enuErrorStatus_t LOC_enuErrorStatus = SCHED_enuOk;
+
+	if (Add_pstrHealth == NULL_PTR)
+	{
+		LOC_enuErrorStatus = SCHED_enuNullPointer;
+	}
+	else
+	{
+#if (SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_ENABLE)
+		/* The handlers of the higher priorities update the counters at any time */
+		CPU_DisableInterrupts();
+		*Add_pstrHealth = timingHealth;
+		CPU_EnableInterrupts();
+#else
+		*Add_pstrHealth = timingHealth;
+#endif
+	}
+
+	return LOC_enuErrorStatus;
+}
+
+
+/**
+ *@brief : Function that clears the timing health counters and histograms, call it from a runnable.
+ *@param : void.
+ *@return: void.
+ */
+void SCHED_resetHealth(void)
+{
+	uint32_t LOC_u32Index;
+
+	for (LOC_u32Index = 0; LOC_u32Index < SCHED_RUNNABLES_CAPACITY; LOC_u32Index++)
+	{
+		SCHED_clearHealth(LOC_u32Index);
+	}
+
+	timingHealth.backlogEvents = 0;
+	timingHealth.maxBacklogTicks = 0;
+}
+#endif
+
+
+#if (SCHED_TRACE_MODE == SCHED_TRACE_ENABLE)
+/**
+ *@brief : Function that records the start of an interrupt handler in the trace, call it first in the handler.
+ *@param : The IRQ number of the interrupt, from "IRQs_t".
+ *@return: void.
+ */
+void SCHED_traceIsrEnter(uint32_t Copy_u32Irq)
+{
+	SCHED_writeTrace(SCHED_TRACE_ISR_BEGIN, Copy_u32Irq);
+}
+
+
+/**
+ *@brief : Function that records the end of an interrupt handler in the trace, call it last in the handler.
+ *@param : The IRQ number of the interrupt, the same as SCHED_traceIsrEnter.
+ *@return: void.
+ */
+void SCHED_traceIsrExit(uint32_t Copy_u32Irq)
+{
+	SCHED_writeTrace(SCHED_TRACE_ISR_END, Copy_u32Irq);
+}
+
+
+/**
+ *@brief : Function that stops recording the trace, so the ring can be read while the scheduler runs.
+ *@param : void.
+ *@return: void.
+ */
+void SCHED_stopTrace(void)
+{
+	schedTrace.recording = 0;
+}
+
+
+/**
+ *@brief : Function that starts recording the trace again after SCHED_stopTrace, the new records
+ * 			overwrite the oldest ones.
+ *@param : void.
+ *@return: void.
+ */
+void SCHED_startTrace(void)
+{
+	schedTrace.recording = 1;
+}
+
+
+/**
+ *@brief : Function that gets the trace ring as bytes, to send them over a UART as they are.
+ *@param : Pointer in which the address of the ring is assigned.
+ *@param : Pointer in which the size of the ring in bytes is assigned.
+ *@return: Error status.
+ */
+SCHED_enuErrorStatus_t SCHED_getTrace(const uint8_t** Add_ppu8Trace, uint32_t* Add_pu32Size)
+{
+	SCHED_enuErrorStatus_t LOC_enuErrorStatus = SCHED_enuOk;
+
+	if ((Add_ppu8Trace == NULL_PTR) || (Add_pu32Size == NULL_PTR))
+	{
+		LOC_enuErrorStatus = SCHED_enuNullPointer;
+	}
+	else
+	{
+		*Add_ppu8Trace = (const uint8_t*)&schedTrace;
+		*Add_pu32Size = sizeof(schedTrace);
+	}
+
+	return LOC_enuErrorStatus;
+}
+#endif
+
+
+#if (SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_ENABLE)
+/**
+ *@brief : Function that raises the running priority to a ceiling so the runnables up to this priority
+ * 			can't preempt the caller, use it around the data that is shared with them (Stack Resource Policy).
+ *@param : The highest priority of the runnables that share the data.
+ *@return: The previous running priority, pass it to SCHED_unlockCeiling.
+ */
+uint32_t SCHED_lockCeiling(uint8_t Copy_u8Ceiling)
+{
+	uint32_t LOC_u32Previous = CPU_GetBasePriority();
+
+	/* Priority zero is the main loop, it can't preempt anything */
+	if (Copy_u8Ceiling != 0)
+	{
+		if (Copy_u8Ceiling > SCHED_PREEMPTIVE_LEVELS)
+		{
+			Copy_u8Ceiling = SCHED_PREEMPTIVE_LEVELS;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+
+		/* BASEPRI_MAX only raises the priority, a nested lock with a lower ceiling changes nothing */
+		CPU_RaiseBasePriority((uint32_t)(SCHED_LOWEST_PREEMPTION_LEVEL - Copy_u8Ceiling + 1) << SCHED_NVIC_PRIORITY_SHIFT);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	return LOC_u32Previous;
+}
+
+
+/**
+ *@brief : Function that gives back the running priority that was before SCHED_lockCeiling.
+ *@param : The value returned by SCHED_lockCeiling.
+ *@return: void.
+ */
+void SCHED_unlockCeiling(uint32_t Copy_u32Previous)
+{
+	CPU_SetBasePriority(Copy_u32Previous);
 }
+#endif
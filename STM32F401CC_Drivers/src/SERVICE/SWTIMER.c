@@ -0,0 +1,557 @@
+/******************************************************************************
+*
+* Module: Software Timers Service.
+*
+* File Name: SWTIMER.c
+*
+* Description: Service's APIs' Implementation, one-shot and periodic software timers on a hierarchical
+* 				timing wheel. Level 0 has a slot for each of the next 64 ticks, each level above has a
+* 				slot for 64 times the ticks of a slot of the level below it. A timer is linked in the
+* 				slot of its expiry at the lowest level that reaches it, and once every 64 ticks of a
+* 				level the next slot of the level above is moved down (cascaded) to it. Starting and
+* 				stopping a timer is a constant time link or unlink, a tick visits one slot of level 0
+* 				and only the timers that expire or cascade in it, each timer cascades at most once per
+* 				level so the cost per tick stays constant however many timers are running.
+*
+* Author: Shaher Shah Abdalla Kamal
+*
+* Date:	17-10-2026
+*
+*******************************************************************************/
+
+
+/****************************************************************************************/
+/*										Includes										*/
+/****************************************************************************************/
+
+
+#include <SERVICE/SWTIMER.h>
+#include <CFG/SWTIMER_cfg.h>
+#include <LIB/cpu_intrinsics.h>
+#include <SERVICE/SCHED.h>
+#if (SWTIMER_TIME_BASE == SWTIMER_TIME_BASE_SYSTICK)
+#include <MCAL/SYSTICK.h>
+#elif ((SWTIMER_TIME_BASE == SWTIMER_TIME_BASE_TIM2) || (SWTIMER_TIME_BASE == SWTIMER_TIME_BASE_TIM5))
+#include <MCAL/TIM.h>
+#include <MCAL/NVIC.h>
+#endif
+
+
+
+/****************************************************************************************/
+/*									Macros Declaration									*/
+/****************************************************************************************/
+
+
+/* Check if the user entered an invalid tick */
+#if (SWTIMER_TICK_US < 10)
+#error "INVALID SWTIMER_TICK_US is selected :(\nIt must be at least 10 microseconds"
+#endif
+
+/* Check also if the user entered an invalid time base. On the scheduler's SysTick the software timers
+ * don't set the period, they count one tick every SWTIMER_SYSTICK_DIVIDER ticks of the scheduler */
+#if ((SWTIMER_TIME_BASE == SWTIMER_TIME_BASE_SYSTICK) && (SCHED_TIME_BASE == SCHED_TIME_BASE_SYSTICK))
+#if (SCHED_TICKLESS_MODE == SCHED_TICKLESS_ENABLE)
+#error "INVALID SWTIMER_TIME_BASE is selected :(\nThe SysTick of a tickless scheduler has no fixed period to count, choose a timer"
+#elif ((SWTIMER_TICK_US % SCHED_TICK_US) != 0)
+#error "INVALID SWTIMER_TICK_US is selected :(\nOn the scheduler's SysTick it must be a multiple of SCHED_TICK_US"
+#endif
+#define SWTIMER_SYSTICK_DIVIDER			(SWTIMER_TICK_US / SCHED_TICK_US)
+#elif (SWTIMER_TIME_BASE == SWTIMER_TIME_BASE_SYSTICK)
+#if (((SWTIMER_TICK_US % 1000) != 0) && (SWTIMER_TICK_US > 1000000))
+#error "INVALID SWTIMER_TICK_US is selected :(\nA SysTick tick longer than 1 second must be a multiple of 1000 microseconds"
+#endif
+#define SWTIMER_SYSTICK_DIVIDER			(1UL)
+#elif ((SWTIMER_TIME_BASE != SWTIMER_TIME_BASE_TIM2) && (SWTIMER_TIME_BASE != SWTIMER_TIME_BASE_TIM5) &&\
+	   (SWTIMER_TIME_BASE != SWTIMER_TIME_BASE_EXTERNAL))
+#error "INVALID SWTIMER_TIME_BASE is selected :(\nIt must be SWTIMER_TIME_BASE_SYSTICK, SWTIMER_TIME_BASE_TIM2, SWTIMER_TIME_BASE_TIM5 or SWTIMER_TIME_BASE_EXTERNAL"
+#endif
+
+/* Check also that the timer isn't the scheduler's one too, it would take the call back and the period of
+ * the one initialized first (the SysTick is shared through its subscribers instead) */
+#if (((SWTIMER_TIME_BASE == SWTIMER_TIME_BASE_TIM2) && (SCHED_TIME_BASE == SCHED_TIME_BASE_TIM2)) ||\
+	 ((SWTIMER_TIME_BASE == SWTIMER_TIME_BASE_TIM5) && (SCHED_TIME_BASE == SCHED_TIME_BASE_TIM5)))
+#error "INVALID SWTIMER_TIME_BASE is selected :(\nIt's the scheduler's time base (SCHED_TIME_BASE), choose the other timer or the SysTick"
+#endif
+
+/* Check also if the user entered an invalid number of levels */
+#if ((SWTIMER_WHEEL_LEVELS < 1) || (SWTIMER_WHEEL_LEVELS > 5))
+#error "INVALID SWTIMER_WHEEL_LEVELS is selected :(\nIt must be from 1 up to 5"
+#endif
+
+/* Check also if the user entered an invalid size of the deferred queue */
+#if ((SWTIMER_DEFERRED_QUEUE_SIZE < 2) || (SWTIMER_DEFERRED_QUEUE_SIZE > 256) ||\
+	 ((SWTIMER_DEFERRED_QUEUE_SIZE & (SWTIMER_DEFERRED_QUEUE_SIZE - 1)) != 0))
+#error "INVALID SWTIMER_DEFERRED_QUEUE_SIZE is selected :(\nIt must be a power of two from 2 up to 256"
+#endif
+
+/* Check also if the user entered an invalid deferred mode */
+#if ((SWTIMER_DEFERRED_MODE != SWTIMER_DEFERRED_POLLING) && (SWTIMER_DEFERRED_MODE != SWTIMER_DEFERRED_SCHED))
+#error "INVALID SWTIMER_DEFERRED_MODE is selected :(\nIt must be SWTIMER_DEFERRED_POLLING or SWTIMER_DEFERRED_SCHED"
+#endif
+
+/* Slots of each level of the wheel, and the bits of the tick that index them */
+#define SWTIMER_LEVEL_BITS				(6)
+#define SWTIMER_LEVEL_SLOTS				(1UL << SWTIMER_LEVEL_BITS)
+#define SWTIMER_LEVEL_MASK				(SWTIMER_LEVEL_SLOTS - 1)
+
+/* The slot of a tick at a level */
+#define SWTIMER_SLOT(TICK, LEVEL)		(((TICK) >> ((LEVEL) * SWTIMER_LEVEL_BITS)) & SWTIMER_LEVEL_MASK)
+
+/* The longest delay or period in ticks, the wheel reaches the ticks up to this one from now */
+#define SWTIMER_MAX_TICKS				(1UL << (SWTIMER_WHEEL_LEVELS * SWTIMER_LEVEL_BITS))
+
+#define SWTIMER_DEFERRED_QUEUE_MASK		(SWTIMER_DEFERRED_QUEUE_SIZE - 1)
+
+/* The software timers' tick is a subscriber of the SysTick interrupt that runs after the scheduler's one */
+#define SWTIMER_SYSTICK_PRIORITY		(2)
+
+/* The timer and the IRQ of the time base */
+#if (SWTIMER_TIME_BASE == SWTIMER_TIME_BASE_TIM2)
+#define SWTIMER_TIMER					TIM_TIMER2
+#define SWTIMER_TIMER_IRQ				IRQ_TIM2
+#elif (SWTIMER_TIME_BASE == SWTIMER_TIME_BASE_TIM5)
+#define SWTIMER_TIMER					TIM_TIMER5
+#define SWTIMER_TIMER_IRQ				IRQ_TIM5
+#endif
+
+
+
+/****************************************************************************************/
+/*								Variables's Declaration									*/
+/****************************************************************************************/
+
+
+/* The slots of the wheel, each one is the head of a circular list of the timers that expire in it */
+static SWTIMER_strLink_t timingWheel [SWTIMER_WHEEL_LEVELS][SWTIMER_LEVEL_SLOTS];
+
+/* The tick that the next SWTIMER_tick handles, the delays are counted from it */
+static volatile uint32_t nextTick = 0;
+
+/* Ring of the expired deferred timers, "deferredHead" is written only by SWTIMER_tick and "deferredTail"
+ * only by SWTIMER_dispatchDeferred, so neither side needs a lock. Both are free running and masked on access */
+static SWTIMER_strTimer_t* volatile deferredQueue [SWTIMER_DEFERRED_QUEUE_SIZE];
+static volatile uint32_t deferredHead = 0;
+static volatile uint32_t deferredTail = 0;
+
+/* Deferred expiries merged into a waiting one or dropped */
+static volatile uint32_t missedExpiries = 0;
+
+
+
+/****************************************************************************************/
+/*								Static Functions' Declaration							*/
+/****************************************************************************************/
+
+
+/**
+ *@brief : Function that converts microseconds to ticks, rounded up.
+ *@param : Time in microseconds.
+ *@return: Time in ticks.
+ */
+static inline uint32_t SWTIMER_toTicks(uint32_t Copy_u32TimeUS)
+{
+	return (Copy_u32TimeUS / SWTIMER_TICK_US) + (((Copy_u32TimeUS % SWTIMER_TICK_US) != 0) ? 1 : 0);
+}
+
+
+/**
+ *@brief : Function that unlinks a timer from its list, it must be called with the interrupts disabled.
+ *@param : The timer.
+ *@return: void.
+ */
+static inline void SWTIMER_unlink(SWTIMER_strTimer_t* Add_pstrTimer)
+{
+	Add_pstrTimer->link.prev->next = Add_pstrTimer->link.next;
+	Add_pstrTimer->link.next->prev = Add_pstrTimer->link.prev;
+	Add_pstrTimer->link.next = NULL_PTR;
+}
+
+
+/**
+ *@brief : Function that links a timer in the slot of its expiry, at the lowest level that reaches it.
+ * 			It must be called with the interrupts disabled and the expiry within SWTIMER_MAX_TICKS
+ * 			ticks from "nextTick".
+ *@param : The timer.
+ *@return: void.
+ */
+static void SWTIMER_link(SWTIMER_strTimer_t* Add_pstrTimer)
+{
+	uint32_t LOC_u32Delta = Add_pstrTimer->expiry - nextTick;
+	uint32_t LOC_u32Level = 0;
+	SWTIMER_strLink_t* LOC_pstrSlot;
+
+	while (((LOC_u32Level + 1) < SWTIMER_WHEEL_LEVELS) &&
+		   (LOC_u32Delta >= (1UL << ((LOC_u32Level + 1) * SWTIMER_LEVEL_BITS))))
+	{
+		LOC_u32Level++;
+	}
+
+	/* Link it at the tail, the timers of a slot expire in the order they were started */
+	LOC_pstrSlot = &timingWheel[LOC_u32Level][SWTIMER_SLOT(Add_pstrTimer->expiry, LOC_u32Level)];
+	Add_pstrTimer->link.next = LOC_pstrSlot;
+	Add_pstrTimer->link.prev = LOC_pstrSlot->prev;
+	LOC_pstrSlot->prev->next = &Add_pstrTimer->link;
+	LOC_pstrSlot->prev = &Add_pstrTimer->link;
+}
+
+
+/**
+ *@brief : Function that moves the timers of the slots of the levels above 0 that start at "nextTick"
+ * 			down to the lower levels, it must be called with the interrupts disabled.
+ *@param : void.
+ *@return: void.
+ */
+static void SWTIMER_cascade(void)
+{
+	uint32_t LOC_u32Level;
+	uint32_t LOC_u32Slot = 0;
+	SWTIMER_strLink_t* LOC_pstrSlot;
+	SWTIMER_strTimer_t* LOC_pstrTimer;
+
+	/* A level cascades when all the levels below it have wrapped around, the higher slots are moved
+	 * after the lower ones so none of their timers lands in a slot that was already emptied */
+	for (LOC_u32Level = 1; (LOC_u32Level < SWTIMER_WHEEL_LEVELS) && (LOC_u32Slot == 0); LOC_u32Level++)
+	{
+		LOC_u32Slot = SWTIMER_SLOT(nextTick, LOC_u32Level);
+		LOC_pstrSlot = &timingWheel[LOC_u32Level][LOC_u32Slot];
+		while (LOC_pstrSlot->next != LOC_pstrSlot)
+		{
+			LOC_pstrTimer = (SWTIMER_strTimer_t*)LOC_pstrSlot->next;
+			SWTIMER_unlink(LOC_pstrTimer);
+			SWTIMER_link(LOC_pstrTimer);
+		}
+	}
+}
+
+
+/**
+ *@brief : Function that queues an expired deferred timer for SWTIMER_dispatchDeferred.
+ *@param : The timer.
+ *@return: void.
+ */
+static void SWTIMER_defer(SWTIMER_strTimer_t* Add_pstrTimer)
+{
+	uint32_t LOC_u32Head = deferredHead;
+
+	if (Add_pstrTimer->queued != 0)
+	{
+		/* Its previous expiry is still waiting, the call back runs once for both */
+		missedExpiries++;
+	}
+	else if ((LOC_u32Head - deferredTail) >= SWTIMER_DEFERRED_QUEUE_SIZE)
+	{
+		missedExpiries++;
+	}
+	else
+	{
+		/* The timer has to be in its slot before the dispatcher can see the new head */
+		Add_pstrTimer->queued = 1;
+		deferredQueue[LOC_u32Head & SWTIMER_DEFERRED_QUEUE_MASK] = Add_pstrTimer;
+		deferredHead = LOC_u32Head + 1;
+
+#if (SWTIMER_DEFERRED_MODE == SWTIMER_DEFERRED_SCHED)
+		/* Posted for every expiry, a post to a full event queue is dropped but its expiry is still
+		 * dispatched by the next one */
+		SCHED_postEvent(SWTIMER_DEFERRED_RUNNABLE);
+#endif
+	}
+}
+
+
+
+/****************************************************************************************/
+/*								Functions' Implementation								*/
+/****************************************************************************************/
+
+
+/**
+ *@brief : Function that initializes the wheel and starts the time base of the software timers.
+ *@param : void.
+ *@return: void.
+ */
+void SWTIMER_init(void)
+{
+	uint32_t LOC_u32Level;
+	uint32_t LOC_u32Slot;
+
+	for (LOC_u32Level = 0; LOC_u32Level < SWTIMER_WHEEL_LEVELS; LOC_u32Level++)
+	{
+		for (LOC_u32Slot = 0; LOC_u32Slot < SWTIMER_LEVEL_SLOTS; LOC_u32Slot++)
+		{
+			timingWheel[LOC_u32Level][LOC_u32Slot].next = &timingWheel[LOC_u32Level][LOC_u32Slot];
+			timingWheel[LOC_u32Level][LOC_u32Slot].prev = &timingWheel[LOC_u32Level][LOC_u32Slot];
+		}
+	}
+
+#if ((SWTIMER_TIME_BASE == SWTIMER_TIME_BASE_SYSTICK) && (SCHED_TIME_BASE == SCHED_TIME_BASE_SYSTICK))
+	/* The scheduler sets the period and starts the SysTick */
+	SYSTICK_Subscribe(SWTIMER_tick, SWTIMER_SYSTICK_DIVIDER, SWTIMER_SYSTICK_PRIORITY);
+#elif (SWTIMER_TIME_BASE == SWTIMER_TIME_BASE_SYSTICK)
+	SYSTICK_Subscribe(SWTIMER_tick, SWTIMER_SYSTICK_DIVIDER, SWTIMER_SYSTICK_PRIORITY);
+#if ((SWTIMER_TICK_US % 1000) == 0)
+	SYSTICK_SetTimeMilliSec(SWTIMER_TICK_US / 1000);
+#else
+	SYSTICK_SetTimeMicroSec(SWTIMER_TICK_US);
+#endif
+	SYSTICK_Start(START_PERIODIC);
+#elif (SWTIMER_TIME_BASE != SWTIMER_TIME_BASE_EXTERNAL)
+	TIM_enuInit(SWTIMER_TIMER);
+	TIM_enuSetCallBack(SWTIMER_TIMER, SWTIMER_tick);
+	TIM_enuSetPeriodMicroSec(SWTIMER_TIMER, SWTIMER_TICK_US);
+	NVIC_EnableIRQ(SWTIMER_TIMER_IRQ);
+	TIM_enuStart(SWTIMER_TIMER);
+#endif
+}
+
+
+/**
+ *@brief : Function that sets up a timer, it must not be running.
+ *@param : The timer, its call back, the context passed to the call back and where the call back runs:
+ * 			SWTIMER_DISPATCH_ISR in the tick's interrupt (keep it short) or SWTIMER_DISPATCH_DEFERRED
+ * 			in SWTIMER_dispatchDeferred.
+ *@return: Error status.
+ */
+SWTIMER_enuErrorStatus_t SWTIMER_create(SWTIMER_strTimer_t* Add_pstrTimer, swTimerCBF_t Copy_CallBackFunction,
+										void* Add_pvContext, uint8_t Copy_u8Dispatch)
+{
+	SWTIMER_enuErrorStatus_t LOC_enuErrorStatus = SWTIMER_enuOk;
+
+	if ((Add_pstrTimer == NULL_PTR) || (Copy_CallBackFunction == NULL_PTR))
+	{
+		LOC_enuErrorStatus = SWTIMER_enuNullPointer;
+	}
+	else if ((Copy_u8Dispatch != SWTIMER_DISPATCH_ISR) && (Copy_u8Dispatch != SWTIMER_DISPATCH_DEFERRED))
+	{
+		LOC_enuErrorStatus = SWTIMER_enuInvalidDispatch;
+	}
+	else
+	{
+		Add_pstrTimer->link.next = NULL_PTR;
+		Add_pstrTimer->link.prev = NULL_PTR;
+		Add_pstrTimer->expiry = 0;
+		Add_pstrTimer->periodTicks = 0;
+		Add_pstrTimer->callBackFn = Copy_CallBackFunction;
+		Add_pstrTimer->context = Add_pvContext;
+		Add_pstrTimer->dispatch = Copy_u8Dispatch;
+		Add_pstrTimer->queued = 0;
+	}
+
+	return LOC_enuErrorStatus;
+}
+
+
+/**
+ *@brief : Function that starts a timer, or restarts it if it's running. It expires at the tick that ends
+ * 			"delay" ticks from now (the first of them is the running tick, so it may expire up to one
+ * 			tick early), then every "period" if the period isn't zero. It takes a constant time and it's
+ * 			safe to call from an interrupt and from a call back.
+ *@param : The timer, the delay to the first expiry and the period in microseconds (0 for one-shot).
+ *@return: Error status.
+ */
+SWTIMER_enuErrorStatus_t SWTIMER_start(SWTIMER_strTimer_t* Add_pstrTimer, uint32_t Copy_u32DelayUS, uint32_t Copy_u32PeriodUS)
+{
+	SWTIMER_enuErrorStatus_t LOC_enuErrorStatus = SWTIMER_enuOk;
+	uint32_t LOC_u32DelayTicks = SWTIMER_toTicks(Copy_u32DelayUS);
+	uint32_t LOC_u32PeriodTicks = SWTIMER_toTicks(Copy_u32PeriodUS);
+	uint32_t LOC_u32Mask;
+
+	if (Add_pstrTimer == NULL_PTR)
+	{
+		LOC_enuErrorStatus = SWTIMER_enuNullPointer;
+	}
+	else if ((LOC_u32DelayTicks == 0) || (LOC_u32DelayTicks > SWTIMER_MAX_TICKS) || (LOC_u32PeriodTicks > SWTIMER_MAX_TICKS))
+	{
+		LOC_enuErrorStatus = SWTIMER_enuInvalidTime;
+	}
+	else
+	{
+		LOC_u32Mask = CPU_SaveAndDisableInterrupts();
+		if (Add_pstrTimer->link.next != NULL_PTR)
+		{
+			SWTIMER_unlink(Add_pstrTimer);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+		Add_pstrTimer->expiry = nextTick + LOC_u32DelayTicks - 1;
+		Add_pstrTimer->periodTicks = LOC_u32PeriodTicks;
+		SWTIMER_link(Add_pstrTimer);
+		CPU_RestoreInterrupts(LOC_u32Mask);
+	}
+
+	return LOC_enuErrorStatus;
+}
+
+
+/**
+ *@brief : Function that stops a timer, a deferred expiry that is still waiting is dropped. It takes a
+ * 			constant time and it's safe to call from an interrupt and from a call back.
+ *@param : The timer.
+ *@return: Error status.
+ */
+SWTIMER_enuErrorStatus_t SWTIMER_stop(SWTIMER_strTimer_t* Add_pstrTimer)
+{
+	SWTIMER_enuErrorStatus_t LOC_enuErrorStatus = SWTIMER_enuOk;
+	uint32_t LOC_u32Mask;
+
+	if (Add_pstrTimer == NULL_PTR)
+	{
+		LOC_enuErrorStatus = SWTIMER_enuNullPointer;
+	}
+	else
+	{
+		LOC_u32Mask = CPU_SaveAndDisableInterrupts();
+		if (Add_pstrTimer->link.next != NULL_PTR)
+		{
+			SWTIMER_unlink(Add_pstrTimer);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+		/* Its entry stays in the deferred queue and is passed over by the dispatcher */
+		Add_pstrTimer->queued = 0;
+		CPU_RestoreInterrupts(LOC_u32Mask);
+	}
+
+	return LOC_enuErrorStatus;
+}
+
+
+/**
+ *@brief : Function that checks if a timer is running.
+ *@param : The timer.
+ *@return: 1 if it's running, 0 otherwise.
+ */
+uint8_t SWTIMER_isRunning(const SWTIMER_strTimer_t* Add_pstrTimer)
+{
+	return ((Add_pstrTimer != NULL_PTR) && (Add_pstrTimer->link.next != NULL_PTR)) ? 1 : 0;
+}
+
+
+/**
+ *@brief : Function that advances the wheel by one tick and expires its timers. It's the call back of
+ * 			the time base, call it once every SWTIMER_TICK_US with SWTIMER_TIME_BASE_EXTERNAL only.
+ *@param : void.
+ *@return: void.
+ */
+void SWTIMER_tick(void)
+{
+	SWTIMER_strLink_t LOC_strExpired;
+	SWTIMER_strLink_t* LOC_pstrSlot;
+	SWTIMER_strTimer_t* LOC_pstrTimer;
+	swTimerCBF_t LOC_CallBackFunction;
+	void* LOC_pvContext;
+	uint32_t LOC_u32Mask;
+
+	LOC_u32Mask = CPU_SaveAndDisableInterrupts();
+	if (SWTIMER_SLOT(nextTick, 0) == 0)
+	{
+		SWTIMER_cascade();
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	/* Move the timers of this tick to a list of their own, so the ones started again from the call backs
+	 * (even with the shortest delay) wait for the next tick */
+	LOC_pstrSlot = &timingWheel[0][SWTIMER_SLOT(nextTick, 0)];
+	if (LOC_pstrSlot->next != LOC_pstrSlot)
+	{
+		LOC_strExpired.next = LOC_pstrSlot->next;
+		LOC_strExpired.prev = LOC_pstrSlot->prev;
+		LOC_strExpired.next->prev = &LOC_strExpired;
+		LOC_strExpired.prev->next = &LOC_strExpired;
+		LOC_pstrSlot->next = LOC_pstrSlot;
+		LOC_pstrSlot->prev = LOC_pstrSlot;
+	}
+	else
+	{
+		LOC_strExpired.next = &LOC_strExpired;
+		LOC_strExpired.prev = &LOC_strExpired;
+	}
+	nextTick++;
+	CPU_RestoreInterrupts(LOC_u32Mask);
+
+	/* One timer at a time with the interrupts disabled, a call back may stop or start any of the timers
+	 * that are still in the list */
+	LOC_u32Mask = CPU_SaveAndDisableInterrupts();
+	while (LOC_strExpired.next != &LOC_strExpired)
+	{
+		LOC_pstrTimer = (SWTIMER_strTimer_t*)LOC_strExpired.next;
+		SWTIMER_unlink(LOC_pstrTimer);
+		if (LOC_pstrTimer->periodTicks != 0)
+		{
+			/* The period is counted from the expiry, not from now, so the timer doesn't drift */
+			LOC_pstrTimer->expiry += LOC_pstrTimer->periodTicks;
+			SWTIMER_link(LOC_pstrTimer);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+
+		if (LOC_pstrTimer->dispatch == SWTIMER_DISPATCH_DEFERRED)
+		{
+			SWTIMER_defer(LOC_pstrTimer);
+		}
+		else
+		{
+			LOC_CallBackFunction = LOC_pstrTimer->callBackFn;
+			LOC_pvContext = LOC_pstrTimer->context;
+			CPU_RestoreInterrupts(LOC_u32Mask);
+			LOC_CallBackFunction(LOC_pvContext);
+			LOC_u32Mask = CPU_SaveAndDisableInterrupts();
+		}
+	}
+	CPU_RestoreInterrupts(LOC_u32Mask);
+}
+
+
+/**
+ *@brief : Function that runs the call backs of the deferred timers that expired, from a single caller
+ * 			(the main loop or the runnable of SWTIMER_DEFERRED_SCHED).
+ *@param : void.
+ *@return: void.
+ */
+void SWTIMER_dispatchDeferred(void)
+{
+	/* The timers that expire while dispatching wait for the next time */
+	uint32_t LOC_u32Head = deferredHead;
+	uint32_t LOC_u32Tail = deferredTail;
+	SWTIMER_strTimer_t* LOC_pstrTimer;
+
+	while (LOC_u32Tail != LOC_u32Head)
+	{
+		LOC_pstrTimer = deferredQueue[LOC_u32Tail & SWTIMER_DEFERRED_QUEUE_MASK];
+		LOC_u32Tail++;
+		deferredTail = LOC_u32Tail;
+
+		/* A timer stopped after it expired isn't queued anymore, an expiry in between the check and the
+		 * clear is merged into this run */
+		if (LOC_pstrTimer->queued != 0)
+		{
+			LOC_pstrTimer->queued = 0;
+			LOC_pstrTimer->callBackFn(LOC_pstrTimer->context);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+}
+
+
+/**
+ *@brief : Function that gets the number of deferred expiries that were merged into a waiting one
+ * 			or dropped because the queue was full.
+ *@param : void.
+ *@return: The number of missed expiries.
+ */
+uint32_t SWTIMER_getMissedExpiries(void)
+{
+	return missedExpiries;
+}
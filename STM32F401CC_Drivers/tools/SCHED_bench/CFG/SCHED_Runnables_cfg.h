@@ -0,0 +1,28 @@
+/******************************************************************************
+ *
+ * File Name: SCHED_Runnables_cfg.h
+ *
+ * Description: Runnables list used by the host benchmark of the Scheduler, it shadows
+ * 				the target's CFG/SCHED_Runnables_cfg.h through the include path.
+ *
+ * Author: Shaher Shah Abdalla Kamal
+ *
+ *******************************************************************************/
+
+#ifndef SCHED_RUNNABLES_CFG_H_
+#define SCHED_RUNNABLES_CFG_H_
+
+/* Number of runnables in the benchmark, passed with -DSCHED_BENCH_RUNNABLES=N */
+#ifndef SCHED_BENCH_RUNNABLES
+#define SCHED_BENCH_RUNNABLES		64
+#endif
+
+typedef enum
+{
+	_RunnablesNumber_ = SCHED_BENCH_RUNNABLES
+}RunnablesList_t;
+
+/* The benchmark has no chains */
+#define SCHED_CHAINS_LIST
+
+#endif /* SCHED_RUNNABLES_CFG_H_ */
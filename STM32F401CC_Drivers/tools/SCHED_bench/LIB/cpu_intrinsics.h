@@ -0,0 +1,59 @@
+/******************************************************************************
+ *
+ * Module: Scheduler host benchmark.
+ *
+ * File Name: cpu_intrinsics.h
+ *
+ * Description: Host replacement of LIB/cpu_intrinsics.h, it shadows the target's one through
+ * 				the include path. The benchmark has no interrupts, so masking them does nothing.
+ *
+ * Author: Shaher Shah Abdalla Kamal
+ *
+ *******************************************************************************/
+
+#ifndef CPU_INTRINSICS_H_
+#define CPU_INTRINSICS_H_
+
+
+#include <LIB/std_types.h>
+
+
+static inline void CPU_DisableInterrupts(void)
+{
+}
+
+static inline void CPU_EnableInterrupts(void)
+{
+}
+
+static inline uint32_t CPU_SaveAndDisableInterrupts(void)
+{
+	return 0;
+}
+
+static inline void CPU_RestoreInterrupts(uint32_t Copy_u32Value)
+{
+	(void)Copy_u32Value;
+}
+
+static inline void CPU_WaitForInterrupt(void)
+{
+}
+
+static inline uint32_t CPU_GetBasePriority(void)
+{
+	return 0;
+}
+
+static inline void CPU_SetBasePriority(uint32_t Copy_u32Value)
+{
+	(void)Copy_u32Value;
+}
+
+static inline void CPU_RaiseBasePriority(uint32_t Copy_u32Value)
+{
+	(void)Copy_u32Value;
+}
+
+
+#endif /* CPU_INTRINSICS_H_ */
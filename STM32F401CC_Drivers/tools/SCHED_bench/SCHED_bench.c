@@ -0,0 +1,251 @@
+/******************************************************************************
+ *
+ * Module: Scheduler host benchmark.
+ *
+ * File Name: SCHED_bench.c
+ *
+ * Description: Measures the dispatch cost per tick of the scheduler's timing wheel against
+ * 				the old core that scanned every runnable with a modulo each tick.
+ * 				The scheduler's source is included directly so its static functions can be
+ * 				called tick by tick without the SysTick. The wheel runs with the
+ * 				SCHED_DISPATCH_POLICY of the SCHED_cfg.h found first in the include path.
+ *
+ * Build:		gcc -O2 -I tools/SCHED_bench -I include -DSCHED_BENCH_RUNNABLES=64 \
+ * 					tools/SCHED_bench/SCHED_bench.c -o SCHED_bench
+ * 				(or run tools/SCHED_bench/run_SCHED_bench.sh from STM32F401CC_Drivers to sweep
+ * 				the number of runnables with each dispatch policy)
+ *
+ * Author: Shaher Shah Abdalla Kamal
+ *
+ *******************************************************************************/
+
+
+/************************************************************************************/
+/*									Includes										*/
+/************************************************************************************/
+
+
+#include "../../src/SERVICE/SCHED.c"
+
+#include <stdio.h>
+#include <time.h>
+
+
+
+/************************************************************************************/
+/*								Macros Declaration									*/
+/************************************************************************************/
+
+
+/* The dispatch policy of the wheel as it's printed */
+#if (SCHED_DISPATCH_POLICY == SCHED_DISPATCH_EDF)
+#define BENCH_POLICY_NAME			"EDF"
+#else
+#define BENCH_POLICY_NAME			"FP"
+#endif
+
+/* Number of simulated ticks for each core */
+#define BENCH_TICKS					(2000000UL)
+
+/* A mix of the periodicities We usually use: LCD, switches, control loops, UI and LEDs */
+#define BENCH_PERIOD(n)				((((n) % 7 == 0) ? 1 : ((n) % 7 == 1) ? 5 : ((n) % 7 == 2) ? 10 :\
+									  ((n) % 7 == 3) ? 20 : ((n) % 7 == 4) ? 50 : ((n) % 7 == 5) ? 100 : 1000) * SCHED_TICK_US)
+
+#define BENCH_RUNNABLE(n)			{ .name = "bench", .periodicityUS = BENCH_PERIOD(n),\
+									  .firstDelayUS = ((n) % 10) * SCHED_TICK_US, .callBackFn = BENCH_runnable },
+
+#define BENCH_REP1					BENCH_RUNNABLE(__COUNTER__)
+#define BENCH_REP2					BENCH_REP1 BENCH_REP1
+#define BENCH_REP4					BENCH_REP2 BENCH_REP2
+#define BENCH_REP8					BENCH_REP4 BENCH_REP4
+#define BENCH_REP16					BENCH_REP8 BENCH_REP8
+#define BENCH_REP32					BENCH_REP16 BENCH_REP16
+#define BENCH_REP64					BENCH_REP32 BENCH_REP32
+#define BENCH_REP128				BENCH_REP64 BENCH_REP64
+
+#if (SCHED_BENCH_RUNNABLES == 1)
+#define BENCH_TABLE					BENCH_REP1
+#elif (SCHED_BENCH_RUNNABLES == 2)
+#define BENCH_TABLE					BENCH_REP2
+#elif (SCHED_BENCH_RUNNABLES == 4)
+#define BENCH_TABLE					BENCH_REP4
+#elif (SCHED_BENCH_RUNNABLES == 8)
+#define BENCH_TABLE					BENCH_REP8
+#elif (SCHED_BENCH_RUNNABLES == 16)
+#define BENCH_TABLE					BENCH_REP16
+#elif (SCHED_BENCH_RUNNABLES == 32)
+#define BENCH_TABLE					BENCH_REP32
+#elif (SCHED_BENCH_RUNNABLES == 64)
+#define BENCH_TABLE					BENCH_REP64
+#elif (SCHED_BENCH_RUNNABLES == 128)
+#define BENCH_TABLE					BENCH_REP128
+#else
+#error "SCHED_BENCH_RUNNABLES must be a power of two from 1 up to 128"
+#endif
+
+
+
+/************************************************************************************/
+/*								Variables's Declaration								*/
+/************************************************************************************/
+
+
+static volatile uint32_t benchCalls = 0;
+
+static void BENCH_runnable(void)
+{
+	benchCalls++;
+}
+
+const runnable_t arrayOfRunnables [_RunnablesNumber_] = { BENCH_TABLE };
+
+/* The delay flags of the old core */
+static uint8_t legacyDelayFlag [_RunnablesNumber_];
+
+
+
+/************************************************************************************/
+/*							SysTick driver replacement								*/
+/************************************************************************************/
+
+
+SYSTICK_enuErrorStatus_t SYSTICK_Start(uint32_t start_)
+{
+	(void)start_;
+	return SYSTICK_enuOk;
+}
+
+SYSTICK_enuErrorStatus_t SYSTICK_Stop(void)
+{
+	return SYSTICK_enuOk;
+}
+
+SYSTICK_enuErrorStatus_t SYSTICK_SetTimeMicroSec(uint32_t DelayTime)
+{
+	(void)DelayTime;
+	return SYSTICK_enuOk;
+}
+
+SYSTICK_enuErrorStatus_t SYSTICK_SetTimeMilliSec(uint32_t DelayTime)
+{
+	(void)DelayTime;
+	return SYSTICK_enuOk;
+}
+
+SYSTICK_enuErrorStatus_t SYSTICK_Subscribe(sysTickCBF_t CallBackFunction, uint32_t Divider, uint8_t Priority)
+{
+	(void)CallBackFunction;
+	(void)Divider;
+	(void)Priority;
+	return SYSTICK_enuOk;
+}
+
+
+
+/************************************************************************************/
+/*							Static Functions' Implementation						*/
+/************************************************************************************/
+
+
+/**
+ *@brief : The old core of the scheduler, kept as is to compare with.
+ *@param : void.
+ *@return: void.
+ */
+static void BENCH_legacySched(void)
+{
+	uint32_t index;
+	static uint32_t legacyTimeStamp = 0;
+	for(index = 0; index < _RunnablesNumber_; index++)
+	{
+		if (legacyTimeStamp >= arrayOfRunnables[index].firstDelayUS && legacyDelayFlag[index] == 0)
+		{
+			legacyTimeStamp = 0;
+			legacyDelayFlag[index] = 1;
+		}
+		if((arrayOfRunnables[index].callBackFn)\
+				&& ((legacyTimeStamp % (arrayOfRunnables[index].periodicityUS)) == 0) && (legacyDelayFlag[index] == 1))
+		{
+			arrayOfRunnables[index].callBackFn();
+		}
+	}
+	legacyTimeStamp += SCHED_TICK_US;
+}
+
+
+/**
+ *@brief : Function that runs one tick of the timing wheel core, the main loop is never behind here.
+ *@param : void.
+ *@return: void.
+ */
+static void BENCH_wheelSched(void)
+{
+	tickCount++;
+	SCHED_runPendingTicks(tickCount);
+#if (SCHED_DISPATCH_POLICY == SCHED_DISPATCH_EDF)
+	SCHED_runReadyHeap();
+#endif
+}
+
+
+/**
+ *@brief : Function that returns the monotonic time in nanoseconds.
+ *@param : void.
+ *@return: Time in nanoseconds.
+ */
+static float64_t BENCH_nowNs(void)
+{
+	struct timespec LOC_strTime;
+	clock_gettime(CLOCK_MONOTONIC, &LOC_strTime);
+	return ((float64_t)LOC_strTime.tv_sec * 1e9) + (float64_t)LOC_strTime.tv_nsec;
+}
+
+
+/**
+ *@brief : Function that runs one core for BENCH_TICKS ticks.
+ *@param : The core to run, pointer in which the number of dispatched callbacks will be assigned.
+ *@return: Average cost of one tick in nanoseconds.
+ */
+static float64_t BENCH_runCore(void (*core)(void), uint32_t* Add_u32Calls)
+{
+	uint32_t LOC_u32Tick;
+	float64_t LOC_f64Start;
+
+	benchCalls = 0;
+	LOC_f64Start = BENCH_nowNs();
+
+	for (LOC_u32Tick = 0; LOC_u32Tick < BENCH_TICKS; LOC_u32Tick++)
+	{
+		core();
+	}
+
+	*Add_u32Calls = benchCalls;
+
+	return (BENCH_nowNs() - LOC_f64Start) / (float64_t)BENCH_TICKS;
+}
+
+
+
+/************************************************************************************/
+/*								Functions' Implementation							*/
+/************************************************************************************/
+
+
+int main(void)
+{
+	uint32_t LOC_u32LegacyCalls;
+	uint32_t LOC_u32WheelCalls;
+	float64_t LOC_f64Legacy;
+	float64_t LOC_f64Wheel;
+
+	SCHED_init();
+
+	LOC_f64Legacy = BENCH_runCore(BENCH_legacySched, &LOC_u32LegacyCalls);
+	LOC_f64Wheel = BENCH_runCore(BENCH_wheelSched, &LOC_u32WheelCalls);
+
+	printf("policy=%-3s runnables=%3d  legacy=%8.2f ns/tick  wheel=%8.2f ns/tick  speedup=%6.2fx  calls(legacy/wheel)=%lu/%lu\n",
+			BENCH_POLICY_NAME, SCHED_BENCH_RUNNABLES, LOC_f64Legacy, LOC_f64Wheel, LOC_f64Legacy / LOC_f64Wheel,
+			LOC_u32LegacyCalls, LOC_u32WheelCalls);
+
+	return 0;
+}
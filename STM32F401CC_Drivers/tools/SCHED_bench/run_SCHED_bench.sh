@@ -0,0 +1,24 @@
+#!/bin/sh
+# Sweeps the number of runnables and prints the dispatch cost of the old and the new scheduler core,
+# with each dispatch policy of the new one.
+# Run it from the STM32F401CC_Drivers directory.
+
+set -e
+
+OUT_DIR=${TMPDIR:-/tmp}
+
+# The policy is set in a copy of the scheduler's configuration that comes first in the include path
+mkdir -p "$OUT_DIR/SCHED_bench_cfg/CFG"
+
+for POLICY in FIXED_PRIORITY EDF
+do
+	sed -e "s/^#define SCHED_DISPATCH_POLICY\([[:space:]]*\).*/#define SCHED_DISPATCH_POLICY\1SCHED_DISPATCH_$POLICY/" \
+		include/CFG/SCHED_cfg.h > "$OUT_DIR/SCHED_bench_cfg/CFG/SCHED_cfg.h"
+
+	for RUNNABLES in 1 2 4 8 16 32 64 128
+	do
+		gcc -O2 -Wall -I "$OUT_DIR/SCHED_bench_cfg" -I tools/SCHED_bench -I include -DSCHED_BENCH_RUNNABLES=$RUNNABLES \
+			tools/SCHED_bench/SCHED_bench.c -o "$OUT_DIR/SCHED_bench_$RUNNABLES"
+		"$OUT_DIR/SCHED_bench_$RUNNABLES"
+	done
+done
@@ -0,0 +1,153 @@
+#!/usr/bin/env python3
+"""
+Module: Scheduler cyclic executive table generator.
+
+File Name: SCHED_cyclic_gen.py
+
+Description: Expands the periodic runnables of src/CFG/SCHED_Runnables_cfg.c over their hyperperiod
+             into the frame table of SCHED_CYCLIC_EXECUTIVE_ENABLE mode (src/CFG/SCHED_CyclicTable_cfg.c).
+             Frame (f) lists, in the order of arrayOfRunnables, the call backs of the runnables with
+             (f % period == firstDelayUS % period) in ticks, the tick handler runs frame (f) at tick (f)
+             of each hyperperiod. The tick is SCHED_TICK_US of include/CFG/SCHED_cfg.h unless --tick-us
+             is given. Identical frames share the same list.
+             It also prints the worst frame from the wcetUS of the runnables, so the timing of the
+             whole schedule is known before running it.
+             Run it again whenever SCHED_Runnables_cfg.c is changed, the table checks at build time
+             that it has the same number of runnables.
+
+Usage:       python3 tools/SCHED_planner/SCHED_cyclic_gen.py [--cfg src/CFG/SCHED_Runnables_cfg.c]
+                     [--out src/CFG/SCHED_CyclicTable_cfg.c] [--tick-us 1000]
+             (run it from the STM32F401CC_Drivers directory)
+
+Author: Shaher Shah Abdalla Kamal
+"""
+
+import argparse
+import math
+import os
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from SCHED_planner import MAX_HYPERPERIOD_TICKS, parse_runnables, read_tick_us
+
+
+# Number of frames written on each line of the table
+FRAMES_PER_LINE = 8
+
+HEADER = """/******************************************************************************
+ *
+ * File Name: SCHED_CyclicTable_cfg.c
+ *
+ * Description: Frame table of the scheduler's cyclic executive mode, generated by
+ * 				tools/SCHED_planner/SCHED_cyclic_gen.py from SCHED_Runnables_cfg.c.
+ * 				DO NOT EDIT it, run the generator again instead.
+ *
+ * 				Hyperperiod:	%d frames of %d us
+ * 				Worst frame:	%d us (%.1f %% of the frame) at frame %d, from the wcetUS of the runnables
+ *
+ * Author: Shaher Shah Abdalla Kamal
+ *
+ *******************************************************************************/
+
+
+
+/************************************************************************************/
+/*									Includes										*/
+/************************************************************************************/
+
+
+#include <SERVICE/SCHED.h>
+
+
+#if (SCHED_CYCLIC_EXECUTIVE_MODE == SCHED_CYCLIC_EXECUTIVE_ENABLE)
+
+
+
+/************************************************************************************/
+/*								extern Public Functions								*/
+/************************************************************************************/
+
+
+"""
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generates the frame table of the cyclic executive mode.")
+    parser.add_argument("--cfg", default="src/CFG/SCHED_Runnables_cfg.c", help="The runnables configuration file")
+    parser.add_argument("--out", default="src/CFG/SCHED_CyclicTable_cfg.c", help="The generated table")
+    parser.add_argument("--tick-us", type=int, default=None, help="The scheduler's tick in microseconds")
+    args = parser.parse_args()
+    if args.tick_us is None:
+        args.tick_us = read_tick_us()
+
+    with open(args.cfg) as cfg_file:
+        runnables = parse_runnables(cfg_file.read())
+
+    periodic = []
+    for runnable in runnables:
+        if runnable["event"] or not runnable["has_callback"] or runnable["period_us"] == 0:
+            continue
+        runnable["period"] = max(1, runnable["period_us"] // args.tick_us)
+        runnable["phase"] = (runnable["first_delay_us"] // args.tick_us) % runnable["period"]
+        periodic.append(runnable)
+
+    hyperperiod = 1
+    for runnable in periodic:
+        hyperperiod = hyperperiod * runnable["period"] // math.gcd(hyperperiod, runnable["period"])
+    if hyperperiod > MAX_HYPERPERIOD_TICKS:
+        sys.exit("SCHED_cyclic_gen: the hyperperiod is %d ticks, choose periods with a bigger common base" % hyperperiod)
+
+    # Each frame is the tuple of its call backs, the distinct ones are numbered in order of appearance
+    frames = []
+    loads = []
+    distinct = {}
+    for frame in range(hyperperiod):
+        released = [r for r in periodic if frame % r["period"] == r["phase"]]
+        callbacks = tuple(r["callback"] for r in released)
+        frames.append(distinct.setdefault(callbacks, len(distinct)))
+        loads.append(sum(r["wcet_us"] for r in released))
+
+    worst = max(loads)
+    worst_frame = loads.index(worst)
+
+    out = [HEADER % (hyperperiod, args.tick_us, worst, 100.0 * worst / args.tick_us, worst_frame)]
+    for callback in sorted({r["callback"] for r in periodic}):
+        out.append("extern void %s(void);\n" % callback)
+
+    out.append("""
+
+
+/************************************************************************************/
+/*								Variables's Definition								*/
+/************************************************************************************/
+
+
+/* The table is generated for this number of runnables, if the build stops here run the generator again */
+typedef char SCHED_cyclicTableIsOutdated [(_RunnablesNumber_ == %d) ? 1 : -1];
+
+/* The call backs of each distinct frame, ended by NULL_PTR */
+""" % len(runnables))
+    for callbacks, index in sorted(distinct.items(), key=lambda item: item[1]):
+        out.append("static const runnableCB_t frame%d [] = { %s };\n" %
+                   (index, ", ".join(list(callbacks) + ["NULL_PTR"])))
+
+    out.append("\n/* The frame of each tick of the hyperperiod */\n")
+    out.append("const runnableCB_t* const SCHED_cyclicTable [%d] = {\n" % hyperperiod)
+    for first in range(0, hyperperiod, FRAMES_PER_LINE):
+        line = ", ".join("frame%d" % index for index in frames[first:first + FRAMES_PER_LINE])
+        out.append("\t/* %5d */ %s,\n" % (first, line))
+    out.append("};\n\n")
+    out.append("const uint32_t SCHED_cyclicFramesNumber = %d;\n\n\n#endif\n" % hyperperiod)
+
+    with open(args.out, "w") as out_file:
+        out_file.write("".join(out))
+
+    print("hyperperiod = %d frames of %d us, %d distinct frames" % (hyperperiod, args.tick_us, len(distinct)))
+    print("worst frame = %d us (%.1f %%) at frame %d" % (worst, 100.0 * worst / args.tick_us, worst_frame))
+    if worst > args.tick_us:
+        print("SCHED_cyclic_gen: warning: the worst frame is longer than the tick, it delays the next frames")
+    print("table is written in %s" % args.out)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,284 @@
+#!/usr/bin/env python3
+"""
+Module: Scheduler offline phase planner.
+
+File Name: SCHED_planner.py
+
+Description: Reads the periodic runnables of src/CFG/SCHED_Runnables_cfg.c (their periodicityUS
+             and wcetUS) and chooses the firstDelayUS of each one so that the runnables released
+             at the same tick are as light as possible over the hyperperiod.
+             It prints the load of the worst tick before and after, and with --write it puts the
+             new firstDelayUS values in the configuration file.
+
+             The runnables are placed one after the other, the heaviest first, each at the phase
+             (from 0 up to its period - 1) that gives the lowest peak with the ones already
+             placed (ties go to the smallest peak sum, then the current phase, then the smallest
+             phase). A runnable without a wcetUS keeps its firstDelayUS.
+             The tick is SCHED_TICK_US of include/CFG/SCHED_cfg.h unless --tick-us is given.
+
+             With --check it tells instead if the runnables meet their deadlines (the next release)
+             with each SCHED_DISPATCH_POLICY, non-preemptive as the main loop runs them:
+             - SCHED_DISPATCH_EDF: the utilisation is 100 % at most and every runnable fits in the
+               shortest busy time before a longer one starts (Jeffay, Stanat and Martel, 1991).
+             - SCHED_DISPATCH_FIXED_PRIORITY: the response time of the first release of each
+               runnable, in the order of the table and blocked by the longest later runnable, is
+               within its period.
+             The tests take the wcetUS values as they are, the scheduler's own time isn't counted.
+
+Usage:       python3 tools/SCHED_planner/SCHED_planner.py [--cfg src/CFG/SCHED_Runnables_cfg.c]
+                     [--tick-us 100] [--write | --check]
+             (run it from the STM32F401CC_Drivers directory)
+
+Author: Shaher Shah Abdalla Kamal
+"""
+
+import argparse
+import math
+import re
+import sys
+
+
+# The scheduler's configuration that has SCHED_TICK_US, and the tick used if it's not found there
+SCHED_CFG_PATH = "include/CFG/SCHED_cfg.h"
+DEFAULT_TICK_US = 1000
+
+# Planning a longer hyperperiod than this takes too long and means the periods need a common base
+MAX_HYPERPERIOD_TICKS = 1000000
+
+
+def blank_comments(text):
+    """Replaces the comments by spaces (keeping the new lines) so offsets in the text stay valid."""
+    def blank(match):
+        return re.sub(r"[^\n]", " ", match.group(0))
+    return re.sub(r"//[^\n]*|/\*.*?\*/", blank, text, flags=re.S)
+
+
+def read_tick_us(path=SCHED_CFG_PATH):
+    """Returns SCHED_TICK_US of the scheduler's configuration, or DEFAULT_TICK_US if it can't be read."""
+    try:
+        with open(path) as cfg_file:
+            tick = re.search(r"^\s*#define\s+SCHED_TICK_US\s+\(?\s*(\d+)", cfg_file.read(), re.M)
+    except OSError:
+        tick = None
+    return int(tick.group(1)) if tick else DEFAULT_TICK_US
+
+
+def parse_runnables(text):
+    """Returns the runnables of "arrayOfRunnables" as a list of dictionaries, in the order of the file."""
+    code = blank_comments(text)
+    table = re.search(r"arrayOfRunnables\s*\[[^\]]*\]\s*=\s*\{", code)
+    if table is None:
+        sys.exit("SCHED_planner: arrayOfRunnables is not found")
+
+    # The table ends at the brace that closes its opening one, the arrays after it (arrayOfModes) have
+    # entries of the same form
+    depth = 1
+    table_end = table.end()
+    while depth > 0:
+        if table_end >= len(code):
+            sys.exit("SCHED_planner: arrayOfRunnables is not closed")
+        depth += {"{": 1, "}": -1}.get(code[table_end], 0)
+        table_end += 1
+
+    runnables = []
+    entry_pattern = re.compile(r"\[\s*(\w+)\s*\]\s*=\s*\{(.*?)\}", re.S)
+    for entry in entry_pattern.finditer(code, table.end(), table_end - 1):
+        fields = {}
+        for field in re.finditer(r"\.(\w+)\s*=\s*([^,]+?)\s*(?=,|$)", entry.group(2), re.S):
+            fields[field.group(1)] = field.group(2)
+
+        delay = re.search(r"\.firstDelayUS\s*=\s*(\w+)", entry.group(2))
+        runnables.append({
+            "id": entry.group(1),
+            "period_us": int(fields.get("periodicityUS", "0"), 0),
+            "first_delay_us": int(fields.get("firstDelayUS", "0"), 0),
+            "wcet_us": int(fields.get("wcetUS", "0"), 0),
+            "event": fields.get("activation", "SCHED_ACTIVATION_PERIODIC") == "SCHED_ACTIVATION_EVENT",
+            "callback": fields.get("callBackFn", "NULL_PTR"),
+            "has_callback": fields.get("callBackFn", "NULL_PTR") not in ("NULL_PTR", "NULL", "0"),
+            # Where the firstDelayUS value is in the file, or where a new field can be added
+            "delay_span": (entry.start(2) + delay.start(1), entry.start(2) + delay.end(1)) if delay else None,
+            "entry_end": entry.end(2),
+        })
+    return runnables
+
+
+def tick_loads(planned, hyperperiod):
+    """Returns the load of each tick of the hyperperiod in microseconds."""
+    loads = [0] * hyperperiod
+    for runnable in planned:
+        for tick in range(runnable["phase"] % runnable["period"], hyperperiod, runnable["period"]):
+            loads[tick] += runnable["wcet_us"]
+    return loads
+
+
+def plan(runnables, hyperperiod):
+    """Chooses the phase of each runnable, returns them in a dictionary by id."""
+    loads = [0] * hyperperiod
+    phases = {}
+    for runnable in sorted(runnables, key=lambda r: (-r["wcet_us"], r["period"])):
+        current = runnable["phase"] % runnable["period"]
+        # A runnable without a WCET adds nothing to any tick, so it keeps its phase
+        if runnable["wcet_us"] == 0:
+            phases[runnable["id"]] = runnable["phase"]
+            continue
+        best = None
+        for phase in range(runnable["period"]):
+            ticks = range(phase, hyperperiod, runnable["period"])
+            peak = max(loads[tick] for tick in ticks)
+            total = sum(loads[tick] for tick in ticks)
+            if best is None or (peak, total, phase != current) < best[0]:
+                best = ((peak, total, phase != current), phase)
+        phases[runnable["id"]] = best[1]
+        for tick in range(best[1], hyperperiod, runnable["period"]):
+            loads[tick] += runnable["wcet_us"]
+    return phases
+
+
+def report(title, planned, hyperperiod, tick_us):
+    loads = tick_loads(planned, hyperperiod)
+    peak = max(loads)
+    worst = loads.index(peak)
+    print("%-7s worst tick = %6d us at tick %-6d utilisation = %5.1f %%   mean = %5.1f %%" %
+          (title, peak, worst, 100.0 * peak / tick_us, 100.0 * sum(loads) / (hyperperiod * tick_us)))
+    return peak
+
+
+def check_edf(periodic):
+    """Returns the first runnable that can miss its deadline with non-preemptive EDF, or None."""
+    by_period = sorted(periodic, key=lambda r: r["period_us"])
+    shortest = by_period[0]["period_us"]
+    for index, runnable in enumerate(by_period):
+        # The demand of the shorter runnables only grows after one of their releases, so the
+        # busy times just after them are the worst ones
+        lengths = sorted({k * other["period_us"] + 1 for other in by_period[:index]
+                          for k in range(1, runnable["period_us"] // other["period_us"] + 1)} | {shortest + 1})
+        for length in lengths:
+            if not shortest < length < runnable["period_us"]:
+                continue
+            demand = runnable["wcet_us"] + sum((length - 1) // other["period_us"] * other["wcet_us"]
+                                               for other in by_period[:index])
+            if demand > length:
+                return runnable
+    return None
+
+
+def response_times(periodic):
+    """Returns the response time of each runnable with non-preemptive fixed priorities, None if it's
+    longer than its period."""
+    responses = []
+    for index, runnable in enumerate(periodic):
+        blocking = max([other["wcet_us"] for other in periodic[index + 1:]] + [0])
+        start = blocking
+        while start is not None:
+            # The releases of the earlier runnables until this one starts run before it
+            new_start = blocking + sum((start // other["period_us"] + 1) * other["wcet_us"]
+                                       for other in periodic[:index])
+            if new_start + runnable["wcet_us"] > runnable["period_us"]:
+                start = None
+            elif new_start == start:
+                break
+            else:
+                start = new_start
+        responses.append(None if start is None else start + runnable["wcet_us"])
+    return responses
+
+
+def check(periodic):
+    utilisation = sum(float(r["wcet_us"]) / r["period_us"] for r in periodic)
+    print("utilisation = %5.1f %%" % (100.0 * utilisation))
+
+    missed = check_edf(periodic)
+    if utilisation > 1.0:
+        print("SCHED_DISPATCH_EDF:            NOT schedulable, the utilisation is more than 100 %")
+    elif missed is not None:
+        print("SCHED_DISPATCH_EDF:            NOT schedulable, %s can be blocked past its deadline" % missed["id"])
+    else:
+        print("SCHED_DISPATCH_EDF:            schedulable")
+
+    responses = response_times(periodic)
+    if None in responses:
+        print("SCHED_DISPATCH_FIXED_PRIORITY: NOT schedulable")
+    else:
+        print("SCHED_DISPATCH_FIXED_PRIORITY: schedulable")
+
+    print("\n%-24s %10s %10s %16s" % ("runnable", "period us", "wcet us", "response us (FP)"))
+    for runnable, response in zip(periodic, responses):
+        print("%-24s %10d %10d %16s" % (runnable["id"], runnable["period_us"], runnable["wcet_us"],
+                                        "missed" if response is None else response))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Chooses the firstDelayUS of the scheduler's runnables.")
+    parser.add_argument("--cfg", default="src/CFG/SCHED_Runnables_cfg.c", help="The runnables configuration file")
+    parser.add_argument("--tick-us", type=int, default=None, help="The scheduler's tick in microseconds")
+    parser.add_argument("--write", action="store_true", help="Write the planned firstDelayUS values in the file")
+    parser.add_argument("--check", action="store_true", help="Check the deadlines with each dispatch policy")
+    args = parser.parse_args()
+    if args.write and args.check:
+        parser.error("--write and --check can't be used together")
+    if args.tick_us is None:
+        args.tick_us = read_tick_us()
+
+    with open(args.cfg) as cfg_file:
+        text = cfg_file.read()
+
+    periodic = []
+    for runnable in parse_runnables(text):
+        if runnable["event"] or not runnable["has_callback"] or runnable["period_us"] == 0:
+            continue
+        if runnable["wcet_us"] == 0:
+            print("SCHED_planner: warning: %s has no wcetUS, it's planned as zero" % runnable["id"])
+        runnable["period"] = max(1, runnable["period_us"] // args.tick_us)
+        runnable["phase"] = runnable["first_delay_us"] // args.tick_us
+        periodic.append(runnable)
+
+    if not periodic:
+        sys.exit("SCHED_planner: no periodic runnables to plan")
+
+    if args.check:
+        # The releases are at the ticks, so are the deadlines
+        for runnable in periodic:
+            runnable["period_us"] = runnable["period"] * args.tick_us
+        check(periodic)
+        return
+
+    hyperperiod = 1
+    for runnable in periodic:
+        hyperperiod = hyperperiod * runnable["period"] // math.gcd(hyperperiod, runnable["period"])
+    if hyperperiod > MAX_HYPERPERIOD_TICKS:
+        sys.exit("SCHED_planner: the hyperperiod is %d ticks, choose periods with a bigger common base" % hyperperiod)
+
+    print("hyperperiod = %d ticks of %d us" % (hyperperiod, args.tick_us))
+    report("before", periodic, hyperperiod, args.tick_us)
+
+    phases = plan(periodic, hyperperiod)
+    for runnable in periodic:
+        runnable["phase"] = phases[runnable["id"]]
+        runnable["new_delay_us"] = runnable["phase"] * args.tick_us
+    report("after", periodic, hyperperiod, args.tick_us)
+
+    print("\n%-24s %10s %10s %14s" % ("runnable", "period us", "wcet us", "firstDelayUS"))
+    for runnable in periodic:
+        print("%-24s %10d %10d %7d -> %d" % (runnable["id"], runnable["period_us"], runnable["wcet_us"],
+                                            runnable["first_delay_us"], runnable["new_delay_us"]))
+
+    if args.write:
+        # Edit from the end of the file so the offsets of the earlier runnables stay valid
+        for runnable in sorted(periodic, key=lambda r: r["entry_end"], reverse=True):
+            if runnable["delay_span"] is not None:
+                start, end = runnable["delay_span"]
+                text = text[:start] + str(runnable["new_delay_us"]) + text[end:]
+            else:
+                insert = text.rfind(",", 0, runnable["entry_end"]) + 1
+                line_start = text.rfind("\n", 0, insert) + 1
+                indent = re.match(r"\s*", text[line_start:]).group(0)
+                text = (text[:insert] + "\n" + indent + ".firstDelayUS = %d," % runnable["new_delay_us"] +
+                        text[insert:])
+        with open(args.cfg, "w") as cfg_file:
+            cfg_file.write(text)
+        print("\nfirstDelayUS values are written in %s" % args.cfg)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,44 @@
+/******************************************************************************
+ *
+ * File Name: SCHED_Runnables_cfg.h
+ *
+ * Description: Runnables list used by the host simulator of the Scheduler, it shadows the
+ * 				target's CFG/SCHED_Runnables_cfg.h through the include path. The list is taken
+ * 				from the workload file passed with -DSIM_WORKLOAD='"workloads/<name>.h"'.
+ *
+ * Author: Shaher Shah Abdalla Kamal
+ *
+ *******************************************************************************/
+
+#ifndef SCHED_RUNNABLES_CFG_H_
+#define SCHED_RUNNABLES_CFG_H_
+
+#ifndef SIM_WORKLOAD
+#define SIM_WORKLOAD				"workloads/mixed.h"
+#endif
+
+typedef enum
+{
+#define SIM_PERIODIC(Name, PeriodUS, FirstDelayUS, MinUS, MaxUS)	SIM_##Name,
+#define SIM_EVENT(Name, MeanGapUS, MinUS, MaxUS)					SIM_##Name,
+#include SIM_WORKLOAD
+#undef SIM_PERIODIC
+#undef SIM_EVENT
+	_RunnablesNumber_
+}RunnablesList_t;
+
+/* The simulator runs the whole workload in a single mode */
+typedef enum
+{
+	SIM_allRunnablesMode,
+	_ModesNumber_
+}ModesList_t;
+
+/* The chains of the workload, a workload may define SIM_CHAINS as a list of
+ * SCHED_CHAIN(SIM_<producer>, SIM_<consumer>) */
+#ifndef SIM_CHAINS
+#define SIM_CHAINS
+#endif
+#define SCHED_CHAINS_LIST			SIM_CHAINS
+
+#endif /* SCHED_RUNNABLES_CFG_H_ */
@@ -0,0 +1,753 @@
+/******************************************************************************
+ *
+ * Module: Scheduler host simulator.
+ *
+ * File Name: SCHED_sim.c
+ *
+ * Description: Runs the scheduler (src/SERVICE/SCHED.c with the target's CFG/SCHED_cfg.h) on a PC
+ * 				against a simulated core clock. The time base (SysTick or timer), the DWT and the event interrupts are
+ * 				driven by a virtual cycle counter, and each runnable of the workload consumes a
+ * 				pseudo-random number of cycles between its min and max. Millions of virtual ticks
+ * 				take seconds, and the same seed gives the same run.
+ * 				It reports for each runnable the release jitter (from the end of the tick of its
+ * 				release until it starts, or from the post for an event runnable), the late runs
+ * 				(ended after their next release), the skipped releases and its CPU share, then the
+ * 				CPU utilisation and the host time the scheduler spends per tick outside the runnables.
+ * 				The exit status is 1 if any deadline is missed or any release is skipped, so it can
+ * 				gate a CI job.
+ * 				Only the normal and tickless modes are simulated, the timing of the cyclic executive
+ * 				mode is known from its generated table (tools/SCHED_planner/SCHED_cyclic_gen.py).
+ *
+ * Build:		gcc -O2 -I tools/SCHED_sim -I include -DSIM_WORKLOAD='"workloads/mixed.h"' \
+ * 					tools/SCHED_sim/SCHED_sim.c -o SCHED_sim
+ * 				(or run tools/SCHED_sim/run_SCHED_sim.sh from STM32F401CC_Drivers)
+ *
+ * Usage:		SCHED_sim [ticks] [seed]
+ *
+ * Author: Shaher Shah Abdalla Kamal
+ *
+ *******************************************************************************/
+
+
+/************************************************************************************/
+/*									Includes										*/
+/************************************************************************************/
+
+
+#include "../../src/SERVICE/SCHED.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <setjmp.h>
+#include <time.h>
+
+
+#if ((SCHED_PREEMPTIVE_MODE == SCHED_PREEMPTIVE_ENABLE) || (SCHED_CYCLIC_EXECUTIVE_MODE == SCHED_CYCLIC_EXECUTIVE_ENABLE))
+#error "The simulator runs the normal and tickless modes only, disable SCHED_PREEMPTIVE_MODE and SCHED_CYCLIC_EXECUTIVE_MODE"
+#endif
+
+
+
+/************************************************************************************/
+/*								Macros Declaration									*/
+/************************************************************************************/
+
+
+#define SIM_CYCLES_PER_US			(AHB_CLOCK_SOURCE_VALUE / 1000000UL)
+#define SIM_CYCLES_PER_MS			(AHB_CLOCK_SOURCE_VALUE / 1000UL)
+
+#define SIM_DEFAULT_TICKS			(1000000UL)
+#define SIM_DEFAULT_SEED			(1UL)
+
+/* No interrupt is scheduled */
+#define SIM_NEVER					(0xFFFFFFFFFFFFFFFFULL)
+
+
+
+/************************************************************************************/
+/*							User-defined types Declaration							*/
+/************************************************************************************/
+
+
+/* One runnable of the workload */
+typedef struct{
+	const char* name;
+	/* Zero for an event runnable */
+	uint32_t periodUS;
+	uint32_t firstDelayUS;
+	/* Event runnables only: the gaps between the posts are from 1 up to twice this */
+	uint32_t meanGapUS;
+	uint32_t minUS;
+	uint32_t maxUS;
+}SIM_strWorkload_t;
+
+/* The measurements of one runnable */
+typedef struct{
+	uint32_t runs;
+	uint32_t lateRuns;
+	uint64_t busyCycles;
+	uint64_t sumJitterCycles;
+	uint64_t maxJitterCycles;
+	/* Event runnables only */
+	uint32_t posts;
+	uint32_t droppedPosts;
+}SIM_strResult_t;
+
+
+
+/************************************************************************************/
+/*								Static Functions' Declaration						*/
+/************************************************************************************/
+
+
+static void SIM_runRunnable(uint32_t Copy_u32Runnable);
+
+
+
+/************************************************************************************/
+/*								Variables's Declaration								*/
+/************************************************************************************/
+
+
+static const SIM_strWorkload_t arrayOfWorkloads [_RunnablesNumber_] = {
+#define SIM_PERIODIC(Name, PeriodUS, FirstDelayUS, MinUS, MaxUS)	{ #Name, PeriodUS, FirstDelayUS, 0, MinUS, MaxUS },
+#define SIM_EVENT(Name, MeanGapUS, MinUS, MaxUS)					{ #Name, 0, 0, MeanGapUS, MinUS, MaxUS },
+#include SIM_WORKLOAD
+#undef SIM_PERIODIC
+#undef SIM_EVENT
+};
+
+/* A call back for each runnable that tells the simulator which one runs */
+#define SIM_PERIODIC(Name, PeriodUS, FirstDelayUS, MinUS, MaxUS)	static void SIM_##Name##_runnable(void) { SIM_runRunnable(SIM_##Name); }
+#define SIM_EVENT(Name, MeanGapUS, MinUS, MaxUS)					static void SIM_##Name##_runnable(void) { SIM_runRunnable(SIM_##Name); }
+#include SIM_WORKLOAD
+#undef SIM_PERIODIC
+#undef SIM_EVENT
+
+const runnable_t arrayOfRunnables [_RunnablesNumber_] = {
+#define SIM_PERIODIC(Name, PeriodUS, FirstDelayUS, MinUS, MaxUS)	[SIM_##Name] = { .name = #Name, .periodicityUS = PeriodUS,\
+																		.firstDelayUS = FirstDelayUS, .wcetUS = MaxUS,\
+																		.callBackFn = SIM_##Name##_runnable },
+#define SIM_EVENT(Name, MeanGapUS, MinUS, MaxUS)					[SIM_##Name] = { .name = #Name, .wcetUS = MaxUS,\
+																		.activation = SCHED_ACTIVATION_EVENT,\
+																		.callBackFn = SIM_##Name##_runnable },
+#include SIM_WORKLOAD
+#undef SIM_PERIODIC
+#undef SIM_EVENT
+};
+
+#if (SCHED_MULTI_MODE == SCHED_MULTI_MODE_ENABLE)
+const SCHED_strMode_t arrayOfModes [_ModesNumber_] = {
+	[SIM_allRunnablesMode] = { .name = "All the runnables of the workload",
+							   .runnables = (const RunnablesList_t []){
+#define SIM_PERIODIC(Name, PeriodUS, FirstDelayUS, MinUS, MaxUS)	SIM_##Name,
+#define SIM_EVENT(Name, MeanGapUS, MinUS, MaxUS)					SIM_##Name,
+#include SIM_WORKLOAD
+#undef SIM_PERIODIC
+#undef SIM_EVENT
+							   _RunnablesNumber_ }
+	}
+};
+#endif
+
+static SIM_strResult_t arrayOfResults [_RunnablesNumber_];
+
+/* The virtual core clock and the end of the run */
+static uint64_t simCycles = 0;
+static uint64_t endCycles = 0;
+static uint64_t idleCycles = 0;
+static jmp_buf simEnd;
+
+/* The time base (SysTick or timer): the call back, the period it reloads when the running one ends and
+ * the end of the running one. Its handler only counts the ticks, so it takes no time */
+static sysTickCBF_t sysTickCallBack = NULL_PTR;
+static uint64_t sysTickLoadCycles = SIM_CYCLES_PER_MS;
+static uint64_t sysTickEndCycles = SIM_NEVER;
+
+/* The next post of each event runnable, and the posts that wait to run */
+static uint64_t arrayOfNextPostCycles [_RunnablesNumber_];
+static uint64_t arrayOfPostCycles [_RunnablesNumber_][SCHED_EVENT_QUEUE_SIZE];
+static uint32_t arrayOfPostHeads [_RunnablesNumber_];
+static uint32_t arrayOfPostTails [_RunnablesNumber_];
+
+static uint64_t randomState = SIM_DEFAULT_SEED;
+
+/* Host time spent inside the runnables, excluded from the scheduler's cost */
+static float64_t hostRunnablesNs = 0;
+
+
+
+/************************************************************************************/
+/*							SysTick and DWT drivers replacement						*/
+/************************************************************************************/
+
+
+SYSTICK_enuErrorStatus_t SYSTICK_Start(uint32_t start_)
+{
+	(void)start_;
+	sysTickEndCycles = simCycles + sysTickLoadCycles;
+	return SYSTICK_enuOk;
+}
+
+SYSTICK_enuErrorStatus_t SYSTICK_Stop(void)
+{
+	sysTickEndCycles = SIM_NEVER;
+	return SYSTICK_enuOk;
+}
+
+SYSTICK_enuErrorStatus_t SYSTICK_SetTimeMicroSec(uint32_t DelayTime)
+{
+	/* As the hardware, the new period is used from the next reload */
+	sysTickLoadCycles = (uint64_t)DelayTime * SIM_CYCLES_PER_US;
+	return SYSTICK_enuOk;
+}
+
+SYSTICK_enuErrorStatus_t SYSTICK_SetTimeMilliSec(uint32_t DelayTime)
+{
+	sysTickLoadCycles = (uint64_t)DelayTime * SIM_CYCLES_PER_MS;
+	return SYSTICK_enuOk;
+}
+
+/* The scheduler is the only subscriber, it runs every interrupt */
+SYSTICK_enuErrorStatus_t SYSTICK_Subscribe(sysTickCBF_t CallBackFunction, uint32_t Divider, uint8_t Priority)
+{
+	(void)Divider;
+	(void)Priority;
+	sysTickCallBack = CallBackFunction;
+	return SYSTICK_enuOk;
+}
+
+#if (SCHED_TIME_BASE != SCHED_TIME_BASE_SYSTICK)
+/* The timer time base is simulated as the SysTick, it counts at the core clock too */
+TIM_enuErrorStatus_t TIM_enuInit(uint32_t Copy_u32Timer)
+{
+	(void)Copy_u32Timer;
+	return TIM_enuOk;
+}
+
+TIM_enuErrorStatus_t TIM_enuSetPeriodMicroSec(uint32_t Copy_u32Timer, uint32_t Copy_u32PeriodUS)
+{
+	(void)Copy_u32Timer;
+	sysTickLoadCycles = (uint64_t)Copy_u32PeriodUS * SIM_CYCLES_PER_US;
+	return TIM_enuOk;
+}
+
+TIM_enuErrorStatus_t TIM_enuStart(uint32_t Copy_u32Timer)
+{
+	(void)Copy_u32Timer;
+	sysTickEndCycles = simCycles + sysTickLoadCycles;
+	return TIM_enuOk;
+}
+
+TIM_enuErrorStatus_t TIM_enuSetCallBack(uint32_t Copy_u32Timer, timCBF_t Copy_CallBackFunction)
+{
+	(void)Copy_u32Timer;
+	sysTickCallBack = Copy_CallBackFunction;
+	return TIM_enuOk;
+}
+
+NVIC_enuErrorStatus_t NVIC_EnableIRQ(IRQs_t IRQ_)
+{
+	(void)IRQ_;
+	return NVIC_enuOk;
+}
+#endif
+
+#if ((SCHED_PROFILING_MODE == SCHED_PROFILING_ENABLE) || (SCHED_TIMING_HEALTH_MODE == SCHED_TIMING_HEALTH_ENABLE))
+DWT_enuErrorStatus_t DWT_enuInit(void)
+{
+	return DWT_enuOk;
+}
+
+uint32_t DWT_u32GetCycleCount(void)
+{
+	return (uint32_t)simCycles;
+}
+#endif
+
+
+
+/************************************************************************************/
+/*							Static Functions' Implementation						*/
+/************************************************************************************/
+
+
+/**
+ *@brief : Function that returns the next pseudo-random number (64-bit LCG), the same seed gives the
+ * 			same sequence on every host.
+ *@param : void.
+ *@return: 32 random bits.
+ */
+static uint32_t SIM_random(void)
+{
+	randomState = (randomState * 6364136223846793005ULL) + 1442695040888963407ULL;
+	return (uint32_t)(randomState >> 32);
+}
+
+
+/**
+ *@brief : Function that returns a random number of cycles.
+ *@param : The range in microseconds.
+ *@return: Cycles.
+ */
+static uint64_t SIM_randomCycles(uint32_t Copy_u32MinUS, uint32_t Copy_u32MaxUS)
+{
+	uint32_t LOC_u32US = Copy_u32MinUS;
+
+	if (Copy_u32MaxUS > Copy_u32MinUS)
+	{
+		LOC_u32US += SIM_random() % (Copy_u32MaxUS - Copy_u32MinUS + 1);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	return (uint64_t)LOC_u32US * SIM_CYCLES_PER_US;
+}
+
+
+/**
+ *@brief : Function that returns the host's monotonic time in nanoseconds.
+ *@param : void.
+ *@return: Time in nanoseconds.
+ */
+static float64_t SIM_hostNs(void)
+{
+	struct timespec LOC_strTime;
+	clock_gettime(CLOCK_MONOTONIC, &LOC_strTime);
+	return ((float64_t)LOC_strTime.tv_sec * 1e9) + (float64_t)LOC_strTime.tv_nsec;
+}
+
+
+/**
+ *@brief : Function that finds the next interrupt.
+ *@param : Pointer in which the event runnable to post is assigned, _RunnablesNumber_ for the SysTick.
+ *@return: Its time in cycles, SIM_NEVER if there is none.
+ */
+static uint64_t SIM_nextInterrupt(uint32_t* Add_pu32Event)
+{
+	uint64_t LOC_u64Next = sysTickEndCycles;
+	uint32_t LOC_u32Runnable;
+
+	/* The SysTick goes first when both come at the same time */
+	*Add_pu32Event = _RunnablesNumber_;
+	for (LOC_u32Runnable = 0; LOC_u32Runnable < _RunnablesNumber_; LOC_u32Runnable++)
+	{
+		if (arrayOfNextPostCycles[LOC_u32Runnable] < LOC_u64Next)
+		{
+			LOC_u64Next = arrayOfNextPostCycles[LOC_u32Runnable];
+			*Add_pu32Event = LOC_u32Runnable;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+
+	return LOC_u64Next;
+}
+
+
+/**
+ *@brief : Function that runs the interrupt that comes now.
+ *@param : The event runnable to post, _RunnablesNumber_ for the SysTick.
+ *@return: void.
+ */
+static void SIM_runInterrupt(uint32_t Copy_u32Event)
+{
+	const SIM_strWorkload_t* LOC_pstrWorkload;
+
+	if (Copy_u32Event == _RunnablesNumber_)
+	{
+		/* The SysTick reloads the period that is loaded now */
+		sysTickEndCycles += sysTickLoadCycles;
+		sysTickCallBack();
+	}
+	else
+	{
+		LOC_pstrWorkload = &arrayOfWorkloads[Copy_u32Event];
+		arrayOfNextPostCycles[Copy_u32Event] += 1 + ((uint64_t)(SIM_random() % (2 * LOC_pstrWorkload->meanGapUS)) * SIM_CYCLES_PER_US);
+		arrayOfResults[Copy_u32Event].posts++;
+
+		if (SCHED_postEvent((RunnablesList_t)Copy_u32Event) == SCHED_enuOk)
+		{
+			arrayOfPostCycles[Copy_u32Event][arrayOfPostHeads[Copy_u32Event] % SCHED_EVENT_QUEUE_SIZE] = simCycles;
+			arrayOfPostHeads[Copy_u32Event]++;
+		}
+		else
+		{
+			arrayOfResults[Copy_u32Event].droppedPosts++;
+		}
+	}
+}
+
+
+/**
+ *@brief : Function that executes a number of cycles of the running code, the interrupts that come in
+ * 			between run first and push its end later.
+ *@param : Number of cycles.
+ *@return: void.
+ */
+static void SIM_execute(uint64_t Copy_u64Cycles)
+{
+	uint32_t LOC_u32Event;
+	uint64_t LOC_u64Next = SIM_nextInterrupt(&LOC_u32Event);
+
+	while ((LOC_u64Next - simCycles) <= Copy_u64Cycles)
+	{
+		Copy_u64Cycles -= LOC_u64Next - simCycles;
+		simCycles = LOC_u64Next;
+		SIM_runInterrupt(LOC_u32Event);
+		LOC_u64Next = SIM_nextInterrupt(&LOC_u32Event);
+	}
+
+	simCycles += Copy_u64Cycles;
+}
+
+
+/**
+ *@brief : The call back of every runnable of the workload: it measures the release jitter, consumes
+ * 			the runnable's cycles and checks its deadline.
+ *@param : Index of the runnable.
+ *@return: void.
+ */
+static void SIM_runRunnable(uint32_t Copy_u32Runnable)
+{
+	const SIM_strWorkload_t* LOC_pstrWorkload = &arrayOfWorkloads[Copy_u32Runnable];
+	SIM_strResult_t* LOC_pstrResult = &arrayOfResults[Copy_u32Runnable];
+	float64_t LOC_f64HostStart = SIM_hostNs();
+	uint64_t LOC_u64Release;
+	uint64_t LOC_u64Start = simCycles;
+	uint64_t LOC_u64Cycles;
+
+	/* An overloaded scheduler never sleeps, so the run also ends here (one tick later, to let the
+	 * releases of the last tick run) */
+	if (simCycles >= (endCycles + SCHED_CYCLES_PER_TICK))
+	{
+		longjmp(simEnd, 1);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	if (LOC_pstrWorkload->periodUS != 0)
+	{
+		/* The release of a tick is processed when the SysTick ends it, with EDF it may run in a later tick */
+#if (SCHED_DISPATCH_POLICY == SCHED_DISPATCH_EDF)
+		LOC_u64Release = ((uint64_t)arrayOfRunnablesCtrl[Copy_u32Runnable].releaseTick + 1) * SCHED_CYCLES_PER_TICK;
+#else
+		LOC_u64Release = ((uint64_t)SCHED_getTime() + 1) * SCHED_CYCLES_PER_TICK;
+#endif
+	}
+	else
+	{
+		LOC_u64Release = arrayOfPostCycles[Copy_u32Runnable][arrayOfPostTails[Copy_u32Runnable] % SCHED_EVENT_QUEUE_SIZE];
+		arrayOfPostTails[Copy_u32Runnable]++;
+	}
+
+	LOC_pstrResult->runs++;
+	LOC_pstrResult->sumJitterCycles += LOC_u64Start - LOC_u64Release;
+	if ((LOC_u64Start - LOC_u64Release) > LOC_pstrResult->maxJitterCycles)
+	{
+		LOC_pstrResult->maxJitterCycles = LOC_u64Start - LOC_u64Release;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	LOC_u64Cycles = SIM_randomCycles(LOC_pstrWorkload->minUS, LOC_pstrWorkload->maxUS);
+	LOC_pstrResult->busyCycles += LOC_u64Cycles;
+
+	hostRunnablesNs += SIM_hostNs() - LOC_f64HostStart;
+	SIM_execute(LOC_u64Cycles);
+	LOC_f64HostStart = SIM_hostNs();
+
+	/* The deadline of a periodic runnable is its next release */
+	if ((LOC_pstrWorkload->periodUS != 0) &&
+		(simCycles > (LOC_u64Release + ((uint64_t)LOC_pstrWorkload->periodUS * SIM_CYCLES_PER_US))))
+	{
+		LOC_pstrResult->lateRuns++;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	hostRunnablesNs += SIM_hostNs() - LOC_f64HostStart;
+}
+
+
+/**
+ *@brief : Function that gets the number of releases of a periodic runnable until the end of the run.
+ *@param : Index of the runnable, number of simulated ticks.
+ *@return: Number of releases.
+ */
+static uint32_t SIM_expectedReleases(uint32_t Copy_u32Runnable, uint32_t Copy_u32Ticks)
+{
+	const SIM_strWorkload_t* LOC_pstrWorkload = &arrayOfWorkloads[Copy_u32Runnable];
+	uint32_t LOC_u32Period = LOC_pstrWorkload->periodUS / SCHED_TICK_US;
+	uint32_t LOC_u32First = LOC_pstrWorkload->firstDelayUS / SCHED_TICK_US;
+	uint32_t LOC_u32Releases = 0;
+
+	if (LOC_u32First < Copy_u32Ticks)
+	{
+		LOC_u32Releases = ((Copy_u32Ticks - 1 - LOC_u32First) / LOC_u32Period) + 1;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	return LOC_u32Releases;
+}
+
+
+/**
+ *@brief : Function that prints the results of the run.
+ *@param : Number of simulated ticks, the seed, and the host time of the run in nanoseconds.
+ *@return: Number of deadline misses and skipped releases.
+ */
+static uint32_t SIM_report(uint32_t Copy_u32Ticks, uint64_t Copy_u64Seed, float64_t Copy_f64HostNs)
+{
+	uint32_t LOC_u32Runnable;
+	uint32_t LOC_u32Expected;
+	uint32_t LOC_u32Skipped;
+	uint32_t LOC_u32Runs = 0;
+	uint32_t LOC_u32Failures = 0;
+	uint64_t LOC_u64Busy = 0;
+	SIM_strResult_t* LOC_pstrResult;
+
+	printf("SCHED_sim: %s, %lu ticks of %lu us, seed %llu, tickless %d, catch-up policy %d\n\n",
+			SIM_WORKLOAD, Copy_u32Ticks, (uint32_t)SCHED_TICK_US, Copy_u64Seed, SCHED_TICKLESS_MODE, SCHED_CATCHUP_POLICY);
+	printf("%-16s %9s %10s %8s %8s %12s %12s %7s\n",
+			"runnable", "period us", "runs", "skipped", "late", "mean jit us", "max jit us", "cpu %");
+
+	for (LOC_u32Runnable = 0; LOC_u32Runnable < _RunnablesNumber_; LOC_u32Runnable++)
+	{
+		LOC_pstrResult = &arrayOfResults[LOC_u32Runnable];
+
+		/* An event runnable "skips" the posts that didn't get in the queue */
+		if (arrayOfWorkloads[LOC_u32Runnable].periodUS != 0)
+		{
+			LOC_u32Expected = SIM_expectedReleases(LOC_u32Runnable, Copy_u32Ticks);
+			LOC_u32Skipped = (LOC_u32Expected > LOC_pstrResult->runs) ? (LOC_u32Expected - LOC_pstrResult->runs) : 0;
+		}
+		else
+		{
+			LOC_u32Skipped = LOC_pstrResult->droppedPosts;
+		}
+
+		printf("%-16s %9lu %10lu %8lu %8lu %12.1f %12.1f %7.2f\n",
+				arrayOfWorkloads[LOC_u32Runnable].name, arrayOfWorkloads[LOC_u32Runnable].periodUS,
+				LOC_pstrResult->runs, LOC_u32Skipped, LOC_pstrResult->lateRuns,
+				(LOC_pstrResult->runs != 0) ? ((float64_t)LOC_pstrResult->sumJitterCycles / LOC_pstrResult->runs / SIM_CYCLES_PER_US) : 0.0,
+				(float64_t)LOC_pstrResult->maxJitterCycles / SIM_CYCLES_PER_US,
+				100.0 * (float64_t)LOC_pstrResult->busyCycles / (float64_t)simCycles);
+
+		LOC_u32Runs += LOC_pstrResult->runs;
+		LOC_u64Busy += LOC_pstrResult->busyCycles;
+		LOC_u32Failures += LOC_u32Skipped + LOC_pstrResult->lateRuns;
+	}
+
+	printf("\ncpu utilisation   = %6.2f %%  (idle %6.2f %%)\n",
+			100.0 * (float64_t)LOC_u64Busy / (float64_t)simCycles, 100.0 * (float64_t)idleCycles / (float64_t)simCycles);
+	printf("scheduler on host = %6.1f ns per tick, %6.1f ns per run (outside the runnables)\n",
+			(Copy_f64HostNs - hostRunnablesNs) / Copy_u32Ticks,
+			(LOC_u32Runs != 0) ? ((Copy_f64HostNs - hostRunnablesNs) / LOC_u32Runs) : 0.0);
+	printf("result            = %s\n", (LOC_u32Failures == 0) ? "PASS" : "FAIL");
+
+	return LOC_u32Failures;
+}
+
+
+#if (SCHED_TICKLESS_MODE == SCHED_TICKLESS_DISABLE)
+/**
+ *@brief : The main loop of SCHED_start in the polling mode, polling the tick count costs nothing
+ * 			in the simulation so the core waits for the next interrupt instead.
+ *@param : void.
+ *@return: void.
+ */
+static void SIM_pollingLoop(void)
+{
+	uint32_t LOC_u32TickCount;
+
+	SYSTICK_Start(START_PERIODIC);
+	while (1)
+	{
+		LOC_u32TickCount = SCHED_getTickCount();
+		if (LOC_u32TickCount != timeStamp)
+		{
+			SCHED_runPendingTicks(LOC_u32TickCount);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+
+#if (SCHED_DISPATCH_POLICY == SCHED_DISPATCH_EDF)
+		SCHED_runReadyHeap();
+#endif
+
+		SCHED_dispatchEvents();
+
+		if ((tickCount == timeStamp) && (eventHead == eventTail))
+		{
+			SIM_waitForInterrupt();
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+}
+#endif
+
+
+
+/************************************************************************************/
+/*								Functions' Implementation							*/
+/************************************************************************************/
+
+
+/**
+ *@brief : The WFI of the simulated core: the time jumps to the next interrupt, the run ends here.
+ *@param : void.
+ *@return: void.
+ */
+void SIM_waitForInterrupt(void)
+{
+	uint32_t LOC_u32Event;
+	uint64_t LOC_u64Next;
+
+	if (simCycles >= endCycles)
+	{
+		longjmp(simEnd, 1);
+	}
+	else
+	{
+		LOC_u64Next = SIM_nextInterrupt(&LOC_u32Event);
+		idleCycles += LOC_u64Next - simCycles;
+		simCycles = LOC_u64Next;
+		SIM_runInterrupt(LOC_u32Event);
+	}
+}
+
+
+/**
+ *@brief : Reads a whole argument as a number, nothing may follow its digits.
+ *@param : The argument, its name for the error message, the largest accepted value, pointer to the value.
+ *@return: void, it exits with status 2 if the argument isn't a number up to the largest value.
+ */
+static void SIM_parseArgument(const char* Add_pcText, const char* Add_pcName, uint64_t Copy_u64Max, uint64_t* Add_pu64Value)
+{
+	char* LOC_pcEnd = NULL_PTR;
+	unsigned long long LOC_u64Value;
+
+	errno = 0;
+	LOC_u64Value = strtoull(Add_pcText, &LOC_pcEnd, 0);
+
+	if ((LOC_pcEnd == Add_pcText) || (*LOC_pcEnd != '\0') || (errno != 0) || (Add_pcText[0] == '-')
+			|| (LOC_u64Value > Copy_u64Max))
+	{
+		printf("SCHED_sim: the %s \"%s\" is not a number up to %llu\nUsage: SCHED_sim [ticks] [seed]\n",
+				Add_pcName, Add_pcText, (unsigned long long)Copy_u64Max);
+		exit(2);
+	}
+	else
+	{
+		*Add_pu64Value = LOC_u64Value;
+	}
+}
+
+
+int main(int argc, char* argv[])
+{
+	uint64_t LOC_u64Ticks = SIM_DEFAULT_TICKS;
+	uint64_t LOC_u64Seed = SIM_DEFAULT_SEED;
+	uint32_t LOC_u32Ticks;
+	uint32_t LOC_u32Runnable;
+	float64_t LOC_f64HostStart;
+
+	if (argc > 3)
+	{
+		printf("Usage: SCHED_sim [ticks] [seed]\n");
+		exit(2);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	if (argc > 1)
+	{
+		SIM_parseArgument(argv[1], "ticks", 0xFFFFFFFFULL, &LOC_u64Ticks);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	if (argc > 2)
+	{
+		SIM_parseArgument(argv[2], "seed", 0xFFFFFFFFFFFFFFFFULL, &LOC_u64Seed);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	/* No tick would give no time to measure, the utilisation would be 0 / 0 */
+	if (LOC_u64Ticks == 0)
+	{
+		printf("SCHED_sim: the number of ticks must be at least 1\n");
+		exit(2);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	LOC_u32Ticks = (uint32_t)LOC_u64Ticks;
+	randomState = LOC_u64Seed;
+	endCycles = (uint64_t)LOC_u32Ticks * SCHED_CYCLES_PER_TICK;
+
+	for (LOC_u32Runnable = 0; LOC_u32Runnable < _RunnablesNumber_; LOC_u32Runnable++)
+	{
+		/* The scheduler never releases a runnable whose period is rounded down to zero ticks */
+		if ((arrayOfWorkloads[LOC_u32Runnable].periodUS != 0) && (arrayOfWorkloads[LOC_u32Runnable].periodUS < SCHED_TICK_US))
+		{
+			printf("SCHED_sim: the period of %s is shorter than SCHED_TICK_US (%lu us)\n",
+					arrayOfWorkloads[LOC_u32Runnable].name, (uint32_t)SCHED_TICK_US);
+			exit(2);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+
+		arrayOfNextPostCycles[LOC_u32Runnable] = (arrayOfWorkloads[LOC_u32Runnable].periodUS == 0) ?
+				(1 + ((uint64_t)(SIM_random() % (2 * arrayOfWorkloads[LOC_u32Runnable].meanGapUS)) * SIM_CYCLES_PER_US)) : SIM_NEVER;
+	}
+
+	SCHED_init();
+
+	LOC_f64HostStart = SIM_hostNs();
+	if (setjmp(simEnd) == 0)
+	{
+#if (SCHED_TICKLESS_MODE == SCHED_TICKLESS_DISABLE)
+		SIM_pollingLoop();
+#else
+		SCHED_start();
+#endif
+	}
+	else
+	{
+		/* The run ended */
+	}
+
+	return (SIM_report(LOC_u32Ticks, LOC_u64Seed, SIM_hostNs() - LOC_f64HostStart) == 0) ? 0 : 1;
+}
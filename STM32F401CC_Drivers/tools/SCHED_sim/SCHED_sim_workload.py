@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+"""
+Module: Scheduler host simulator workload generator.
+
+File Name: SCHED_sim_workload.py
+
+Description: Writes the runnables of src/CFG/SCHED_Runnables_cfg.c as a workload of the host
+             simulator (tools/SCHED_sim/workloads/app.h by default), so an edit of the table can be
+             simulated before flashing. Each runnable takes its wcetUS on every run, and each event
+             runnable is posted about every --event-gap-us (the table doesn't say how often).
+             Runnables without a call back never run and are left out.
+
+Usage:       python3 tools/SCHED_sim/SCHED_sim_workload.py [--cfg src/CFG/SCHED_Runnables_cfg.c]
+                     [--out tools/SCHED_sim/workloads/app.h] [--event-gap-us 10000]
+             tools/SCHED_sim/run_SCHED_sim.sh -t 1000000 -s 1 app
+             (run them from the STM32F401CC_Drivers directory)
+
+Author: Shaher Shah Abdalla Kamal
+"""
+
+import argparse
+import os
+import sys
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "SCHED_planner"))
+from SCHED_planner import parse_runnables
+
+
+HEADER = """/******************************************************************************
+ *
+ * File Name: %s
+ *
+ * Description: Workload of the scheduler's host simulator generated by
+ * 				tools/SCHED_sim/SCHED_sim_workload.py from %s.
+ * 				DO NOT EDIT it, run the generator again instead.
+ *
+ * Author: Shaher Shah Abdalla Kamal
+ *
+ *******************************************************************************/
+
+"""
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Writes the runnables table as a workload of the host simulator.")
+    parser.add_argument("--cfg", default="src/CFG/SCHED_Runnables_cfg.c", help="The runnables configuration file")
+    parser.add_argument("--out", default="tools/SCHED_sim/workloads/app.h", help="The generated workload")
+    parser.add_argument("--event-gap-us", type=int, default=10000, help="Mean time between the posts of an event")
+    args = parser.parse_args()
+
+    with open(args.cfg) as cfg_file:
+        runnables = [r for r in parse_runnables(cfg_file.read()) if r["has_callback"]]
+
+    periodic = [r for r in runnables if not r["event"] and r["period_us"] != 0]
+    events = [r for r in runnables if r["event"]]
+    if not periodic and not events:
+        sys.exit("SCHED_sim_workload: no runnables to simulate")
+
+    out = [HEADER % (os.path.basename(args.out), args.cfg)]
+    if periodic:
+        out.append("/*            %-16s%-12s%-16s%-8s%-8s*/\n" % ("name", "period us", "first delay us", "min us", "max us"))
+        for r in periodic:
+            out.append("SIM_PERIODIC(  %-16s%-12s%-16s%-8s%-8s)\n" %
+                       (r["id"] + ",", "%d," % r["period_us"], "%d," % r["first_delay_us"], "%d," % r["wcet_us"], r["wcet_us"]))
+    if events:
+        out.append("\n/*            %-16s%-12s%-8s%-8s*/\n" % ("name", "mean gap us", "min us", "max us"))
+        for r in events:
+            out.append("SIM_EVENT(     %-16s%-12s%-8s%-8s)\n" %
+                       (r["id"] + ",", "%d," % args.event_gap_us, "%d," % r["wcet_us"], r["wcet_us"]))
+
+    with open(args.out, "w") as out_file:
+        out_file.write("".join(out))
+
+    print("%d periodic and %d event runnables are written in %s" % (len(periodic), len(events), args.out))
+    if any(r["wcet_us"] == 0 for r in runnables):
+        print("SCHED_sim_workload: warning: some runnables have no wcetUS, they take no time in the simulation")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,64 @@
+#!/bin/sh
+# Builds the scheduler's host simulator for each workload and runs it, the exit status is not zero
+# if any workload misses a deadline. Run it from the STM32F401CC_Drivers directory:
+#	tools/SCHED_sim/run_SCHED_sim.sh [-t ticks] [-s seed] [workload ...]
+# (the workloads are the names of the files in tools/SCHED_sim/workloads, "mixed" by default)
+# A workload that needs other scheduler settings lists them in lines "SIM_CFG <macro> <value>", they are
+# set in a copy of SCHED_cfg.h that comes first in the include path of that workload only.
+
+set -e
+
+USAGE="Usage: $0 [-t ticks] [-s seed] [workload ...]"
+OUT_DIR=${TMPDIR:-/tmp}
+TICKS=1000000
+SEED=1
+
+while getopts "t:s:h" OPTION
+do
+	case $OPTION in
+	t)	TICKS=$OPTARG ;;
+	s)	SEED=$OPTARG ;;
+	*)	echo "$USAGE" >&2; exit 2 ;;
+	esac
+done
+shift $((OPTIND - 1))
+[ $# -gt 0 ] || set -- mixed
+
+for WORKLOAD in "$@"
+do
+	if [ ! -f "tools/SCHED_sim/workloads/$WORKLOAD.h" ]
+	then
+		echo "run_SCHED_sim: no workload \"$WORKLOAD\" in tools/SCHED_sim/workloads" >&2
+		echo "$USAGE" >&2
+		exit 2
+	fi
+done
+
+STATUS=0
+
+for WORKLOAD in "$@"
+do
+	CFG_DIR="$OUT_DIR/SCHED_sim_cfg_$WORKLOAD"
+	mkdir -p "$CFG_DIR/CFG"
+	cp include/CFG/SCHED_cfg.h "$CFG_DIR/CFG/SCHED_cfg.h"
+	for SETTING in $(sed -n 's/.*SIM_CFG[[:space:]]\{1,\}\([A-Za-z0-9_]\{1,\}\)[[:space:]]\{1,\}\([^[:space:]]\{1,\}\).*/\1=\2/p' \
+					"tools/SCHED_sim/workloads/$WORKLOAD.h")
+	do
+		NAME=${SETTING%%=*}
+		VALUE=${SETTING#*=}
+		if ! grep -q "^#define $NAME[[:space:]]" "$CFG_DIR/CFG/SCHED_cfg.h"
+		then
+			echo "run_SCHED_sim: $WORKLOAD sets $NAME that is not in SCHED_cfg.h" >&2
+			exit 2
+		fi
+		sed -e "s/^#define $NAME\([[:space:]]*\).*/#define $NAME\1$VALUE/" "$CFG_DIR/CFG/SCHED_cfg.h" > "$CFG_DIR/SCHED_cfg.h"
+		mv "$CFG_DIR/SCHED_cfg.h" "$CFG_DIR/CFG/SCHED_cfg.h"
+	done
+
+	gcc -O2 -Wall -I "$CFG_DIR" -I tools/SCHED_sim -I include -DSIM_WORKLOAD="\"workloads/$WORKLOAD.h\"" \
+		tools/SCHED_sim/SCHED_sim.c -o "$OUT_DIR/SCHED_sim_$WORKLOAD"
+	"$OUT_DIR/SCHED_sim_$WORKLOAD" "$TICKS" "$SEED" || STATUS=1
+	echo
+done
+
+exit $STATUS
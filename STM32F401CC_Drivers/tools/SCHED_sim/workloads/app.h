@@ -0,0 +1,16 @@
+/******************************************************************************
+ *
+ * File Name: app.h
+ *
+ * Description: Workload of the scheduler's host simulator generated by
+ * 				tools/SCHED_sim/SCHED_sim_workload.py from src/CFG/SCHED_Runnables_cfg.c.
+ * 				DO NOT EDIT it, run the generator again instead.
+ *
+ * Author: Shaher Shah Abdalla Kamal
+ *
+ *******************************************************************************/
+
+/*            name            period us   first delay us  min us  max us  */
+SIM_PERIODIC(  toggleTheLED,   1000000,    50000,          0,      0       )
+SIM_PERIODIC(  testLCD,        1000000,    50000,          0,      0       )
+SIM_PERIODIC(  lcdRunnable,    1000,       0,              0,      0       )
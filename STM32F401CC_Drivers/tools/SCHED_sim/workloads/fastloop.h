@@ -0,0 +1,25 @@
+/******************************************************************************
+ *
+ * File Name: fastloop.h
+ *
+ * Description: Workload of the scheduler's host simulator: a 10 kHz current loop next to the
+ * 				LCD and slow UI runnables. It needs SCHED_TICK_US of 100, run_SCHED_sim.sh builds
+ * 				it with the setting below. With run to completion every runnable has to fit in the slack
+ * 				of the current loop's tick, so the slow ones do their jobs in short steps
+ * 				(as coroutines do).
+ *
+ * Author: Shaher Shah Abdalla Kamal
+ *
+ *******************************************************************************/
+
+/* SIM_CFG SCHED_TICK_US 100 */
+
+/*				name			period us	first delay us	min us	max us	*/
+SIM_PERIODIC(	currentLoop,	100,		0,				20,		30			)
+SIM_PERIODIC(	speedLoop,		1000,		0,				20,		35			)
+SIM_PERIODIC(	lcd,			1000,		500,			5,		15			)
+SIM_PERIODIC(	ui,				10000,		200,			20,		50			)
+SIM_PERIODIC(	logger,			20000,		700,			20,		50			)
+
+/*				name			mean gap us	min us	max us	*/
+SIM_EVENT(		uartFrame,		2500,		15,		30		)
@@ -0,0 +1,23 @@
+/******************************************************************************
+ *
+ * File Name: mixed.h
+ *
+ * Description: Workload of the scheduler's host simulator: the periodicities We usually use
+ * 				(LCD, switches, control loops, UI and LEDs) with spread first delays, and a
+ * 				UART frame handler released by events. It fits in the CPU, so no deadline is missed.
+ *
+ * Author: Shaher Shah Abdalla Kamal
+ *
+ *******************************************************************************/
+
+/*				name			period us	first delay us	min us	max us	*/
+SIM_PERIODIC(	lcd,			1000,		0,				20,		60			)
+SIM_PERIODIC(	switches,		5000,		1000,			30,		80			)
+SIM_PERIODIC(	motorControl,	10000,		2000,			150,	300			)
+SIM_PERIODIC(	sensors,		20000,		3000,			100,	400			)
+SIM_PERIODIC(	ui,				50000,		4000,			200,	600			)
+SIM_PERIODIC(	logger,			100000,		7000,			300,	800			)
+SIM_PERIODIC(	ledToggle,		1000000,	9000,			5,		10			)
+
+/*				name			mean gap us	min us	max us	*/
+SIM_EVENT(		uartFrame,		2500,		40,		120		)
@@ -0,0 +1,19 @@
+/******************************************************************************
+ *
+ * File Name: overload.h
+ *
+ * Description: Workload of the scheduler's host simulator that doesn't fit: the control loop
+ * 				sometimes takes longer than a tick and the logger lands on the same ticks,
+ * 				so the 1 ms runnable misses deadlines and the catch-up policy is exercised.
+ *
+ * Author: Shaher Shah Abdalla Kamal
+ *
+ *******************************************************************************/
+
+/*				name			period us	first delay us	min us	max us	*/
+SIM_PERIODIC(	lcd,			1000,		0,				50,		150			)
+SIM_PERIODIC(	motorControl,	4000,		1000,			400,	1400		)
+SIM_PERIODIC(	logger,			20000,		1000,			500,	2500		)
+
+/*				name			mean gap us	min us	max us	*/
+SIM_EVENT(		uartFrame,		1000,		100,	300		)
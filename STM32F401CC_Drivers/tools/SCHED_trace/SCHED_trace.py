@@ -0,0 +1,148 @@
+#!/usr/bin/env python3
+"""
+Module: Scheduler trace converter.
+
+File Name: SCHED_trace.py
+
+Description: Converts a dump of the scheduler's trace ring ("schedTrace", SCHED_TRACE_MODE is
+             SCHED_TRACE_ENABLE) to the Chrome trace event format (JSON), open it in
+             https://ui.perfetto.dev or chrome://tracing to see when each runnable and interrupt
+             started and ended.
+             The dump is the raw bytes of the ring, from a debugger:
+                 (gdb) dump binary value trace.bin schedTrace
+                 (openocd) dump_image trace.bin <address of schedTrace> <sizeof(schedTrace)>
+             or the bytes given by SCHED_getTrace sent over a UART and saved in a file (the ring is
+             found in it by its magic number, so the bytes before it are passed over).
+             The runnables are named from RunnablesList_t of include/CFG/SCHED_Runnables_cfg.h
+             (the dynamic slots come after them) and the interrupts from IRQs_t of
+             include/MCAL/INTERRUPTS.h. The records of a run whose start was overwritten in the ring
+             are dropped, and a run that hasn't ended is ended at the last record.
+
+Usage:       python3 tools/SCHED_trace/SCHED_trace.py trace.bin [--out trace.json]
+                     [--runnables include/CFG/SCHED_Runnables_cfg.h] [--irqs include/MCAL/INTERRUPTS.h]
+             (run it from the STM32F401CC_Drivers directory)
+
+Author: Shaher Shah Abdalla Kamal
+"""
+
+import argparse
+import json
+import re
+import struct
+import sys
+
+
+# Must match SCHED_TRACE_MAGIC, the types of the records and SCHED_TRACE_TICK_ISR of the scheduler
+TRACE_MAGIC = 0x52544353
+RUNNABLE_BEGIN, RUNNABLE_END, ISR_BEGIN, ISR_END = range(4)
+TICK_ISR = 0xFFFF
+
+# magic, recordsNumber, cyclesPerUs, head, recording, then the records (cycles, id, type, reserved)
+HEADER = struct.Struct("<5I")
+RECORD = struct.Struct("<IHBB")
+
+
+def read_enum(path, name):
+    """Returns the values of a C enum as a dictionary of names by value, the first name wins."""
+    try:
+        with open(path) as header_file:
+            text = re.sub(r"//[^\n]*|/\*.*?\*/", "", header_file.read(), flags=re.S)
+    except OSError:
+        return {}
+    body = re.search(r"typedef\s+enum\s*\{(.*?)\}\s*" + name + r"\s*;", text, re.S)
+    names = {}
+    value = -1
+    for entry in (body.group(1).split(",") if body else []):
+        match = re.match(r"\s*(\w+)\s*(?:=\s*(\w+))?\s*$", entry)
+        if match is None:
+            continue
+        value = int(match.group(2), 0) if match.group(2) else value + 1
+        names.setdefault(value, match.group(1))
+    return names
+
+
+def read_trace(data):
+    """Returns the core clock in MHz, the head of the ring and its records from the oldest one."""
+    start = data.find(struct.pack("<I", TRACE_MAGIC))
+    if start < 0 or len(data) < start + HEADER.size:
+        sys.exit("SCHED_trace: no trace ring is found in the dump")
+    _, records_number, cycles_per_us, head, _ = HEADER.unpack_from(data, start)
+    if len(data) < start + HEADER.size + records_number * RECORD.size:
+        sys.exit("SCHED_trace: the dump ends before the %d records of the ring" % records_number)
+
+    count = min(head, records_number)
+    first = head - count
+    records = []
+    for index in range(first, head):
+        offset = start + HEADER.size + (index % records_number) * RECORD.size
+        cycles, record_id, record_type, _ = RECORD.unpack_from(data, offset)
+        records.append((cycles, record_id, record_type))
+    return cycles_per_us, head, records
+
+
+def to_events(records, cycles_per_us, runnable_names, irq_names):
+    """Converts the records to begin and end events of the Chrome trace format, in microseconds."""
+    events = []
+    stack = []
+    time = 0
+    previous = records[0][0] if records else 0
+    for cycles, record_id, record_type in records:
+        # The cycle counter wraps around, the records are never that far apart
+        time += (cycles - previous) & 0xFFFFFFFF
+        previous = cycles
+        if record_type in (RUNNABLE_BEGIN, RUNNABLE_END):
+            name = runnable_names.get(record_id, "slot %d" % (record_id - len(runnable_names)))
+            category = "runnable"
+        elif record_id == TICK_ISR:
+            name = "SysTick"
+            category = "isr"
+        else:
+            name = irq_names.get(record_id, "IRQ %d" % record_id)
+            category = "isr"
+
+        if record_type in (RUNNABLE_BEGIN, ISR_BEGIN):
+            stack.append((record_id, record_type, name, category))
+            phase = "B"
+        elif stack and stack[-1][:2] == (record_id, record_type - 1):
+            stack.pop()
+            phase = "E"
+        else:
+            # Its start was overwritten in the ring, or it's not nested as the core runs them
+            continue
+        events.append({"name": name, "cat": category, "ph": phase, "ts": time / float(cycles_per_us),
+                       "pid": 0, "tid": 0})
+
+    # End what is still running at the last record
+    while stack:
+        _, _, name, category = stack.pop()
+        events.append({"name": name, "cat": category, "ph": "E", "ts": time / float(cycles_per_us),
+                       "pid": 0, "tid": 0})
+    return events
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Converts a dump of the scheduler's trace ring to Chrome trace JSON.")
+    parser.add_argument("dump", help="The raw bytes of schedTrace")
+    parser.add_argument("--out", default="trace.json", help="The JSON file to write")
+    parser.add_argument("--runnables", default="include/CFG/SCHED_Runnables_cfg.h", help="The runnables list")
+    parser.add_argument("--irqs", default="include/MCAL/INTERRUPTS.h", help="The IRQ numbers list")
+    args = parser.parse_args()
+
+    with open(args.dump, "rb") as dump_file:
+        cycles_per_us, head, records = read_trace(dump_file.read())
+
+    runnable_names = read_enum(args.runnables, "RunnablesList_t")
+    runnable_names = {value: name for value, name in runnable_names.items() if name != "_RunnablesNumber_"}
+    events = to_events(records, cycles_per_us, runnable_names, read_enum(args.irqs, "IRQs_t"))
+
+    with open(args.out, "w") as out_file:
+        json.dump({"traceEvents": [{"name": "process_name", "ph": "M", "pid": 0,
+                                    "args": {"name": "STM32F401CC scheduler"}}] + events,
+                   "displayTimeUnit": "ns"}, out_file, indent=0)
+
+    print("%d of %d records (%d lost), %d events are written in %s" %
+          (len(records), head, head - len(records), len(events), args.out))
+
+
+if __name__ == "__main__":
+    main()